@@ -17,6 +17,8 @@
 ////////////////////////////////////////////////////////////////////////////
 
 using System;
+using System.Runtime.InteropServices;
+using System.Text;
 using Realms.Native;
 using Realms.Schema;
 
@@ -65,6 +67,71 @@ public PrimitiveValue GetPrimitiveAtIndex(int index, PropertyType type)
 
         public abstract byte[] GetByteArrayAtIndex(int index);
 
+        public T[] GetPrimitives<T>(PropertyType type, int start, int count)
+        {
+            return MarshalHelpers.GetPrimitives<T>(type, count, (IntPtr values, byte[] nullBitmap, out NativeException ex) =>
+                GetPrimitiveRangeCore(type, (IntPtr)start, (IntPtr)count, values, nullBitmap, out ex));
+        }
+
+        protected abstract IntPtr GetPrimitiveRangeCore(PropertyType type, IntPtr start, IntPtr count, IntPtr values, byte[] nullBitmap, out NativeException nativeException);
+
+        public string[] GetStrings(int start, int count) => MarshalHelpers.GetStrings(start, count, GetStringsCore);
+
+        protected abstract IntPtr GetStringsCore(IntPtr start, IntPtr count, IntPtr buffer, IntPtr bufferSize, IntPtr[] offsets, byte[] nullBitmap,
+            out IntPtr requiredSize, out NativeException nativeException);
+
+        // The view points into the Realm file, so the string is decoded straight from there rather than copied
+        // into a buffer first.
+        public unsafe string GetStringViewAtIndex(int index)
+        {
+            var hasValue = GetStringViewCore((IntPtr)index, out var view, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            if (!hasValue)
+            {
+                return null;
+            }
+
+            return view.size == IntPtr.Zero ? string.Empty : Encoding.UTF8.GetString(view.data, (int)view.size);
+        }
+
+        protected abstract bool GetStringViewCore(IntPtr index, out DataView view, out NativeException nativeException);
+
+        public unsafe byte[] GetByteArrayViewAtIndex(int index)
+        {
+            var hasValue = GetByteArrayViewCore((IntPtr)index, out var view, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            if (!hasValue)
+            {
+                return null;
+            }
+
+            var result = new byte[(int)view.size];
+            if (result.Length > 0)
+            {
+                Marshal.Copy((IntPtr)view.data, result, 0, result.Length);
+            }
+
+            return result;
+        }
+
+        protected abstract bool GetByteArrayViewCore(IntPtr index, out DataView view, out NativeException nativeException);
+
+        /// <summary>
+        /// Computes an aggregate of the numbers or dates of the collection, or of the property at propertyIndex
+        /// of its objects. The result has no value for the min, max or average of an empty collection.
+        /// </summary>
+        public PrimitiveValue Aggregate(IntPtr propertyIndex, AggregateType type)
+        {
+            var result = new PrimitiveValue();
+            AggregateCore(propertyIndex, type, ref result, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return result;
+        }
+
+        protected abstract void AggregateCore(IntPtr propertyIndex, AggregateType type, ref PrimitiveValue result, out NativeException nativeException);
+
         public abstract int Count();
 
         public abstract ResultsHandle Snapshot();
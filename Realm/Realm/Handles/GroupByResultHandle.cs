@@ -0,0 +1,158 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+using Realms.Native;
+using Realms.Schema;
+
+namespace Realms
+{
+    internal class GroupByResultHandle : RealmHandle
+    {
+        private static class NativeMethods
+        {
+#pragma warning disable IDE1006 // Naming Styles
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr result);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_get_group_count", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_group_count(GroupByResultHandle result, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_get_key_type", CallingConvention = CallingConvention.Cdecl)]
+            public static extern PropertyType get_key_type(GroupByResultHandle result, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_get_counts", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_counts(GroupByResultHandle result, IntPtr start, IntPtr count, [Out] IntPtr[] counts, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_get_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_keys(GroupByResultHandle result, IntPtr start, IntPtr count, [Out] long[] keys, [Out] byte[] null_bitmap, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_get_string_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_string_keys(GroupByResultHandle result, IntPtr start, IntPtr count, IntPtr buffer, IntPtr buffer_size, [Out] IntPtr[] offsets,
+                [Out] byte[] null_bitmap, out IntPtr required_size, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "group_by_result_get_values", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_values(GroupByResultHandle result, IntPtr aggregate_ndx, IntPtr start, IntPtr count, [Out] PrimitiveValue[] values,
+                out NativeException ex);
+
+#pragma warning restore IDE1006 // Naming Styles
+        }
+
+        public GroupByResultHandle(RealmHandle root, IntPtr handle) : base(root, handle)
+        {
+        }
+
+        public int GroupCount
+        {
+            get
+            {
+                var result = NativeMethods.get_group_count(this, out var nativeException);
+                nativeException.ThrowIfNecessary();
+                return (int)result;
+            }
+        }
+
+        public PropertyType KeyType
+        {
+            get
+            {
+                var result = NativeMethods.get_key_type(this, out var nativeException);
+                nativeException.ThrowIfNecessary();
+                return result;
+            }
+        }
+
+        public int[] GetCounts()
+        {
+            var groupCount = GroupCount;
+            var counts = new IntPtr[groupCount];
+            var read = (int)NativeMethods.get_counts(this, IntPtr.Zero, (IntPtr)groupCount, counts, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            var result = new int[read];
+            for (var i = 0; i < read; i++)
+            {
+                result[i] = (int)counts[i];
+            }
+
+            return result;
+        }
+
+        // The key of every group, in the order the groups were found: a string, a long, an ObjectKey for links
+        // or a DateTimeOffset for the start of the bucket of dates. Null keys are returned as null.
+        public object[] GetKeys()
+        {
+            var groupCount = GroupCount;
+            var keyType = KeyType.UnderlyingType();
+            if (keyType == PropertyType.String)
+            {
+                return MarshalHelpers.GetStrings(0, groupCount, (IntPtr start, IntPtr count, IntPtr buffer, IntPtr bufferSize, IntPtr[] offsets, byte[] nullBitmap,
+                    out IntPtr requiredSize, out NativeException ex) =>
+                    NativeMethods.get_string_keys(this, start, count, buffer, bufferSize, offsets, nullBitmap, out requiredSize, out ex));
+            }
+
+            var keys = new long[groupCount];
+            var nullBitmap = new byte[(groupCount / 8) + 1];
+            var read = (int)NativeMethods.get_keys(this, IntPtr.Zero, (IntPtr)groupCount, keys, nullBitmap, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            var result = new object[read];
+            for (var i = 0; i < read; i++)
+            {
+                if ((nullBitmap[i / 8] & (1 << (i % 8))) != 0)
+                {
+                    continue;
+                }
+
+                switch (keyType)
+                {
+                    case PropertyType.Date:
+                        result[i] = new DateTimeOffset(keys[i], TimeSpan.Zero);
+                        break;
+                    case PropertyType.Object:
+                        result[i] = new ObjectKey(keys[i]);
+                        break;
+                    default:
+                        result[i] = keys[i];
+                        break;
+                }
+            }
+
+            return result;
+        }
+
+        // The results of the aggregate at aggregateIndex of the specs passed to ResultsHandle.GroupBy, one per group.
+        public PrimitiveValue[] GetValues(int aggregateIndex)
+        {
+            var groupCount = GroupCount;
+            var values = new PrimitiveValue[groupCount];
+            var read = (int)NativeMethods.get_values(this, (IntPtr)aggregateIndex, IntPtr.Zero, (IntPtr)groupCount, values, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            Array.Resize(ref values, read);
+            return values;
+        }
+
+        protected override void Unbind()
+        {
+            NativeMethods.destroy(handle);
+        }
+    }
+}
@@ -17,8 +17,10 @@
 ////////////////////////////////////////////////////////////////////////////
 
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 using Realms.Native;
+using Realms.Schema;
 
 namespace Realms
 {
@@ -46,6 +48,43 @@ private static class NativeMethods
             public static extern void add_binary(ListHandle listHandle, IntPtr buffer, IntPtr bufferLength,
                 [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_string_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_string_utf8(ListHandle listHandle, byte[] value, IntPtr valueLength,
+                [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_primitives", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_primitives(ListHandle listHandle, PropertyType type, IntPtr values, byte[] null_bitmap, IntPtr count, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_bool", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_bool(ListHandle listHandle, [MarshalAs(UnmanagedType.U1)] bool value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_nullable_bool", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_nullable_bool(ListHandle listHandle, [MarshalAs(UnmanagedType.U1)] bool value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_int64", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_int64(ListHandle listHandle, long value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_nullable_int64", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_nullable_int64(ListHandle listHandle, long value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_float", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_float(ListHandle listHandle, float value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_nullable_float", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_nullable_float(ListHandle listHandle, float value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_double", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_double(ListHandle listHandle, double value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_nullable_double", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_nullable_double(ListHandle listHandle, double value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_timestamp_ticks", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_timestamp_ticks(ListHandle listHandle, long value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_add_nullable_timestamp_ticks", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void add_nullable_timestamp_ticks(ListHandle listHandle, long value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
             #endregion
 
             #region set
@@ -66,6 +105,44 @@ private static class NativeMethods
             public static extern void set_binary(ListHandle listHandle, IntPtr targetIndex, IntPtr buffer, IntPtr bufferLength,
                 [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_string_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_string_utf8(ListHandle listHandle, IntPtr targetIndex, byte[] value, IntPtr valueLength,
+                [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_primitives", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_primitives(ListHandle listHandle, IntPtr targetIndex, PropertyType type, IntPtr values, byte[] null_bitmap, IntPtr count,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_bool", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_bool(ListHandle listHandle, IntPtr targetIndex, [MarshalAs(UnmanagedType.U1)] bool value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_nullable_bool", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_nullable_bool(ListHandle listHandle, IntPtr targetIndex, [MarshalAs(UnmanagedType.U1)] bool value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_int64", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_int64(ListHandle listHandle, IntPtr targetIndex, long value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_nullable_int64", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_nullable_int64(ListHandle listHandle, IntPtr targetIndex, long value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_float", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_float(ListHandle listHandle, IntPtr targetIndex, float value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_nullable_float", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_nullable_float(ListHandle listHandle, IntPtr targetIndex, float value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_double", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_double(ListHandle listHandle, IntPtr targetIndex, double value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_nullable_double", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_nullable_double(ListHandle listHandle, IntPtr targetIndex, double value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_timestamp_ticks", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_timestamp_ticks(ListHandle listHandle, IntPtr targetIndex, long value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_set_nullable_timestamp_ticks", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_nullable_timestamp_ticks(ListHandle listHandle, IntPtr targetIndex, long value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
             #endregion
 
             #region insert
@@ -86,6 +163,44 @@ private static class NativeMethods
             public static extern void insert_binary(ListHandle listHandle, IntPtr targetIndex, IntPtr buffer, IntPtr bufferLength,
                 [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_string_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_string_utf8(ListHandle listHandle, IntPtr targetIndex, byte[] value, IntPtr valueLength,
+                [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_primitives", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_primitives(ListHandle listHandle, IntPtr targetIndex, PropertyType type, IntPtr values, byte[] null_bitmap, IntPtr count,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_bool", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_bool(ListHandle listHandle, IntPtr targetIndex, [MarshalAs(UnmanagedType.U1)] bool value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_nullable_bool", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_nullable_bool(ListHandle listHandle, IntPtr targetIndex, [MarshalAs(UnmanagedType.U1)] bool value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_int64", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_int64(ListHandle listHandle, IntPtr targetIndex, long value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_nullable_int64", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_nullable_int64(ListHandle listHandle, IntPtr targetIndex, long value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_float", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_float(ListHandle listHandle, IntPtr targetIndex, float value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_nullable_float", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_nullable_float(ListHandle listHandle, IntPtr targetIndex, float value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_double", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_double(ListHandle listHandle, IntPtr targetIndex, double value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_nullable_double", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_nullable_double(ListHandle listHandle, IntPtr targetIndex, double value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_timestamp_ticks", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_timestamp_ticks(ListHandle listHandle, IntPtr targetIndex, long value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_insert_nullable_timestamp_ticks", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void insert_nullable_timestamp_ticks(ListHandle listHandle, IntPtr targetIndex, long value, [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
             #endregion
 
             #region get
@@ -104,6 +219,25 @@ private static class NativeMethods
             public static extern IntPtr get_binary(ListHandle listHandle, IntPtr link_ndx, IntPtr buffer, IntPtr bufsize,
                 [MarshalAs(UnmanagedType.I1)] out bool isNull, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_get_string_view", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_string_view(ListHandle listHandle, IntPtr link_ndx, out DataView value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_get_binary_view", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_binary_view(ListHandle listHandle, IntPtr link_ndx, out DataView value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_get_primitive_range", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_primitive_range(ListHandle listHandle, PropertyType type, IntPtr start, IntPtr count, IntPtr values, byte[] null_bitmap,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_get_strings", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_strings(ListHandle listHandle, IntPtr start, IntPtr count, IntPtr buffer, IntPtr buffer_size, [Out] IntPtr[] offsets,
+                [Out] byte[] null_bitmap, out IntPtr required_size, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_aggregate", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void aggregate(ListHandle listHandle, IntPtr property_ndx, AggregateType type, ref PrimitiveValue value, out NativeException ex);
+
             #endregion
 
             #region find
@@ -124,6 +258,10 @@ private static class NativeMethods
             public static extern IntPtr find_binary(ListHandle listHandle, IntPtr buffer, IntPtr bufsize,
                 [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_find_string_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr find_string_utf8(ListHandle listHandle, byte[] value, IntPtr valueLen,
+                [MarshalAs(UnmanagedType.I1)] bool has_value, out NativeException ex);
+
             #endregion
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "list_erase", CallingConvention = CallingConvention.Cdecl)]
@@ -178,6 +316,8 @@ public ListHandle(RealmHandle root, IntPtr handle) : base(root, handle)
         {
         }
 
+        protected override HandleKind? Kind => HandleKind.List;
+
         protected override void Unbind()
         {
             NativeMethods.destroy(handle);
@@ -203,8 +343,24 @@ public override byte[] GetByteArrayAtIndex(int index)
                 NativeMethods.get_binary(this, (IntPtr)index, buffer, bufferLength, out isNull, out ex));
         }
 
+        protected override IntPtr GetPrimitiveRangeCore(PropertyType type, IntPtr start, IntPtr count, IntPtr values, byte[] nullBitmap, out NativeException nativeException) =>
+            NativeMethods.get_primitive_range(this, type, start, count, values, nullBitmap, out nativeException);
+
+        protected override IntPtr GetStringsCore(IntPtr start, IntPtr count, IntPtr buffer, IntPtr bufferSize, IntPtr[] offsets, byte[] nullBitmap,
+            out IntPtr requiredSize, out NativeException nativeException) =>
+            NativeMethods.get_strings(this, start, count, buffer, bufferSize, offsets, nullBitmap, out requiredSize, out nativeException);
+
+        protected override bool GetStringViewCore(IntPtr index, out DataView view, out NativeException nativeException) =>
+            NativeMethods.get_string_view(this, index, out view, out nativeException);
+
+        protected override bool GetByteArrayViewCore(IntPtr index, out DataView view, out NativeException nativeException) =>
+            NativeMethods.get_binary_view(this, index, out view, out nativeException);
+
         #endregion
 
+        protected override void AggregateCore(IntPtr propertyIndex, AggregateType type, ref PrimitiveValue result, out NativeException nativeException) =>
+            NativeMethods.aggregate(this, propertyIndex, type, ref result, out nativeException);
+
         #region Add
 
         public void Add(ObjectHandle objectHandle)
@@ -232,6 +388,79 @@ public unsafe void Add(byte[] value)
                 NativeMethods.add_binary(this, buffer, bufferSize, hasValue, out ex));
         }
 
+        public void Add(bool value)
+        {
+            NativeMethods.add_bool(this, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(bool? value)
+        {
+            NativeMethods.add_nullable_bool(this, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(long value)
+        {
+            NativeMethods.add_int64(this, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(long? value)
+        {
+            NativeMethods.add_nullable_int64(this, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(float value)
+        {
+            NativeMethods.add_float(this, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(float? value)
+        {
+            NativeMethods.add_nullable_float(this, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(double value)
+        {
+            NativeMethods.add_double(this, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(double? value)
+        {
+            NativeMethods.add_nullable_double(this, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(DateTimeOffset value)
+        {
+            NativeMethods.add_timestamp_ticks(this, value.ToUniversalTime().Ticks, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Add(DateTimeOffset? value)
+        {
+            NativeMethods.add_nullable_timestamp_ticks(this, value.GetValueOrDefault().ToUniversalTime().Ticks, value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void AddPrimitives<T>(IList<T> values, PropertyType type)
+        {
+            MarshalHelpers.SetPrimitives(type, values, (IntPtr packed, byte[] nullBitmap, out NativeException ex) =>
+                NativeMethods.add_primitives(this, type, packed, nullBitmap, (IntPtr)values.Count, out ex));
+        }
+
+        // value is UTF-8 that is stored as is, so it must be valid.
+        public void AddUtf8(byte[] value)
+        {
+            NativeMethods.add_string_utf8(this, value, (IntPtr)(value?.Length ?? 0), value != null, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
         #endregion
 
         #region Set
@@ -263,6 +492,79 @@ public unsafe void Set(int targetIndex, byte[] value)
                 NativeMethods.set_binary(this, (IntPtr)targetIndex, buffer, bufferSize, hasValue, out ex));
         }
 
+        public void Set(int targetIndex, bool value)
+        {
+            NativeMethods.set_bool(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, bool? value)
+        {
+            NativeMethods.set_nullable_bool(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, long value)
+        {
+            NativeMethods.set_int64(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, long? value)
+        {
+            NativeMethods.set_nullable_int64(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, float value)
+        {
+            NativeMethods.set_float(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, float? value)
+        {
+            NativeMethods.set_nullable_float(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, double value)
+        {
+            NativeMethods.set_double(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, double? value)
+        {
+            NativeMethods.set_nullable_double(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, DateTimeOffset value)
+        {
+            NativeMethods.set_timestamp_ticks(this, (IntPtr)targetIndex, value.ToUniversalTime().Ticks, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Set(int targetIndex, DateTimeOffset? value)
+        {
+            NativeMethods.set_nullable_timestamp_ticks(this, (IntPtr)targetIndex, value.GetValueOrDefault().ToUniversalTime().Ticks, value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        // Overwrites values.Count elements starting at targetIndex.
+        public void SetPrimitives<T>(int targetIndex, IList<T> values, PropertyType type)
+        {
+            MarshalHelpers.SetPrimitives(type, values, (IntPtr packed, byte[] nullBitmap, out NativeException ex) =>
+                NativeMethods.set_primitives(this, (IntPtr)targetIndex, type, packed, nullBitmap, (IntPtr)values.Count, out ex));
+        }
+
+        public void SetUtf8(int targetIndex, byte[] value)
+        {
+            NativeMethods.set_string_utf8(this, (IntPtr)targetIndex, value, (IntPtr)(value?.Length ?? 0), value != null, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
         #endregion
 
         #region Insert
@@ -294,6 +596,78 @@ public unsafe void Insert(int targetIndex, byte[] value)
                 NativeMethods.insert_binary(this, (IntPtr)targetIndex, buffer, bufferSize, hasValue, out ex));
         }
 
+        public void Insert(int targetIndex, bool value)
+        {
+            NativeMethods.insert_bool(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, bool? value)
+        {
+            NativeMethods.insert_nullable_bool(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, long value)
+        {
+            NativeMethods.insert_int64(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, long? value)
+        {
+            NativeMethods.insert_nullable_int64(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, float value)
+        {
+            NativeMethods.insert_float(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, float? value)
+        {
+            NativeMethods.insert_nullable_float(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, double value)
+        {
+            NativeMethods.insert_double(this, (IntPtr)targetIndex, value, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, double? value)
+        {
+            NativeMethods.insert_nullable_double(this, (IntPtr)targetIndex, value.GetValueOrDefault(), value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, DateTimeOffset value)
+        {
+            NativeMethods.insert_timestamp_ticks(this, (IntPtr)targetIndex, value.ToUniversalTime().Ticks, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void Insert(int targetIndex, DateTimeOffset? value)
+        {
+            NativeMethods.insert_nullable_timestamp_ticks(this, (IntPtr)targetIndex, value.GetValueOrDefault().ToUniversalTime().Ticks, value.HasValue, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void InsertPrimitives<T>(int targetIndex, IList<T> values, PropertyType type)
+        {
+            MarshalHelpers.SetPrimitives(type, values, (IntPtr packed, byte[] nullBitmap, out NativeException ex) =>
+                NativeMethods.insert_primitives(this, (IntPtr)targetIndex, type, packed, nullBitmap, (IntPtr)values.Count, out ex));
+        }
+
+        public void InsertUtf8(int targetIndex, byte[] value)
+        {
+            NativeMethods.insert_string_utf8(this, (IntPtr)targetIndex, value, (IntPtr)(value?.Length ?? 0), value != null, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
         #endregion
 
         #region Find
@@ -333,6 +707,13 @@ public unsafe int Find(byte[] value)
             return (int)result;
         }
 
+        public int FindUtf8(byte[] value)
+        {
+            var result = NativeMethods.find_string_utf8(this, value, (IntPtr)(value?.Length ?? 0), value != null, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return (int)result;
+        }
+
         #endregion
 
         public void Erase(IntPtr rowIndex)
@@ -17,8 +17,10 @@
 ////////////////////////////////////////////////////////////////////////////
 
 using System;
+using System.Collections.Generic;
 using System.Diagnostics.CodeAnalysis;
 using System.Runtime.InteropServices;
+using System.Text;
 using Realms.Native;
 
 namespace Realms
@@ -58,6 +60,37 @@ private static class NativeMethods
             public static extern IntPtr get_string(ObjectHandle handle, IntPtr propertyIndex,
                 IntPtr buffer, IntPtr bufsize, [MarshalAs(UnmanagedType.I1)] out bool isNull, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_set_string_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_string_utf8(ObjectHandle handle, IntPtr propertyIndex, byte[] value, IntPtr valueLen, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_string_view", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_string_view(ObjectHandle handle, IntPtr propertyIndex, out DataView value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_binary_view", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_binary_view(ObjectHandle handle, IntPtr propertyIndex, out DataView value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_key_path_object", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_key_path_object(ObjectHandle handle, [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] property_chain, IntPtr chain_length,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_key_path_primitive", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_key_path_primitive(ObjectHandle handle, [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] property_chain, IntPtr chain_length,
+                ref PrimitiveValue value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_key_path_string", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_key_path_string(ObjectHandle handle, [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] property_chain, IntPtr chain_length,
+                IntPtr buffer, IntPtr bufsize, [MarshalAs(UnmanagedType.I1)] out bool isNull, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_all_properties", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_all_properties(ObjectHandle handle, [Out] PropertyValue[] values, IntPtr values_count, [Out] byte[] arena, IntPtr arena_size,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_set_properties", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void set_properties(ObjectHandle handle, [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] property_indices, [In] PropertyValue[] values,
+                IntPtr count, byte[] arena, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_set_link", CallingConvention = CallingConvention.Cdecl)]
             public static extern void set_link(ObjectHandle handle, IntPtr propertyIndex, ObjectHandle targetHandle, out NativeException ex);
 
@@ -147,6 +180,9 @@ private static class NativeMethods
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_backlink_count", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_backlink_count(ObjectHandle objectHandle, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_backlink_count_for_property", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_backlink_count_for_property(ObjectHandle objectHandle, IntPtr propertyIndex, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "object_get_is_frozen", CallingConvention = CallingConvention.Cdecl)]
             [return: MarshalAs(UnmanagedType.I1)]
             public static extern bool get_is_frozen(ObjectHandle objectHandle, out NativeException ex);
@@ -208,6 +244,8 @@ public override bool IsFrozen
             }
         }
 
+        protected override HandleKind? Kind => HandleKind.Object;
+
         protected override void Unbind()
         {
             NativeMethods.destroy(handle);
@@ -283,6 +321,127 @@ public string GetString(IntPtr propertyIndex)
             return MarshalHelpers.GetString((IntPtr buffer, IntPtr length, out bool isNull, out NativeException ex) => NativeMethods.get_string(this, propertyIndex, buffer, length, out isNull, out ex));
         }
 
+        // Sets a string that is already UTF-8 encoded, saving the conversion from UTF-16 on the native side.
+        public void SetUtf8(IntPtr propertyIndex, byte[] value)
+        {
+            NativeException nativeException;
+            if (value != null)
+            {
+                NativeMethods.set_string_utf8(this, propertyIndex, value, (IntPtr)value.Length, out nativeException);
+            }
+            else
+            {
+                NativeMethods.set_null(this, propertyIndex, out nativeException);
+            }
+
+            nativeException.ThrowIfNecessary();
+        }
+
+        // Decodes the string straight from the memory of the Realm rather than from a copy.
+        public unsafe string GetStringView(IntPtr propertyIndex)
+        {
+            var hasValue = NativeMethods.get_string_view(this, propertyIndex, out var view, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            if (!hasValue)
+            {
+                return null;
+            }
+
+            return view.size == IntPtr.Zero ? string.Empty : Encoding.UTF8.GetString(view.data, (int)view.size);
+        }
+
+        public unsafe byte[] GetByteArrayView(IntPtr propertyIndex)
+        {
+            var hasValue = NativeMethods.get_binary_view(this, propertyIndex, out var view, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            if (!hasValue)
+            {
+                return null;
+            }
+
+            var result = new byte[(int)view.size];
+            if (result.Length > 0)
+            {
+                Marshal.Copy((IntPtr)view.data, result, 0, result.Length);
+            }
+
+            return result;
+        }
+
+        // The key path methods follow the links of propertyChain and read the last property in it. A null link
+        // along the way reads as a null value.
+        public bool TryGetKeyPathLink(IntPtr[] propertyChain, out ObjectHandle objectHandle)
+        {
+            var result = NativeMethods.get_key_path_object(this, propertyChain, (IntPtr)propertyChain.Length, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            if (result == IntPtr.Zero)
+            {
+                objectHandle = null;
+                return false;
+            }
+
+            objectHandle = new ObjectHandle(Root, result);
+            return true;
+        }
+
+        public PrimitiveValue GetKeyPathPrimitive(IntPtr[] propertyChain)
+        {
+            var result = new PrimitiveValue();
+            NativeMethods.get_key_path_primitive(this, propertyChain, (IntPtr)propertyChain.Length, ref result, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return result;
+        }
+
+        public string GetKeyPathString(IntPtr[] propertyChain)
+        {
+            return MarshalHelpers.GetString((IntPtr buffer, IntPtr length, out bool isNull, out NativeException ex) =>
+                NativeMethods.get_key_path_string(this, propertyChain, (IntPtr)propertyChain.Length, buffer, length, out isNull, out ex));
+        }
+
+        // Reads every persisted property, in schema order, as the .NET types PropertyValue.Get returns.
+        // propertyCount must cover all of them.
+        public object[] GetAllProperties(int propertyCount)
+        {
+            var values = new PropertyValue[propertyCount];
+            var arena = new byte[256];
+            while (true)
+            {
+                var requiredSize = (int)NativeMethods.get_all_properties(this, values, (IntPtr)propertyCount, arena, (IntPtr)arena.Length, out var nativeException);
+                nativeException.ThrowIfNecessary();
+
+                if (requiredSize <= arena.Length)
+                {
+                    break;
+                }
+
+                arena = new byte[requiredSize];
+            }
+
+            var result = new object[propertyCount];
+            for (var i = 0; i < propertyCount; i++)
+            {
+                result[i] = values[i].Get(arena);
+            }
+
+            return result;
+        }
+
+        // Sets the properties at propertyIndices to values in one call. Values are converted by PropertyValue.Create.
+        public void SetProperties(IntPtr[] propertyIndices, IList<object> values)
+        {
+            if (propertyIndices.Length != values.Count)
+            {
+                throw new ArgumentException("There must be one value per property index.", nameof(values));
+            }
+
+            var propertyValues = PropertyValue.Create(values, out var arena);
+            NativeMethods.set_properties(this, propertyIndices, propertyValues, (IntPtr)propertyValues.Length, arena, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
         public void SetLink(IntPtr propertyIndex, ObjectHandle targetHandle)
         {
             NativeMethods.set_link(this, propertyIndex, targetHandle, out var nativeException);
@@ -565,6 +724,13 @@ public int GetBacklinkCount()
             return (int)result;
         }
 
+        public int GetBacklinkCount(IntPtr propertyIndex)
+        {
+            var result = NativeMethods.get_backlink_count_for_property(this, propertyIndex, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return (int)result;
+        }
+
         public override ThreadSafeReferenceHandle GetThreadSafeReference()
         {
             var result = NativeMethods.get_thread_safe_reference(this, out var nativeException);
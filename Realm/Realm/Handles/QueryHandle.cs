@@ -1,4 +1,4 @@
-////////////////////////////////////////////////////////////////////////////
+﻿////////////////////////////////////////////////////////////////////////////
 //
 // Copyright 2016 Realm Inc.
 //
@@ -68,6 +68,30 @@ private static class NativeMethods
             public static extern void string_like(QueryHandle queryPtr, ColumnKey columnKey,
                         [MarshalAs(UnmanagedType.LPWStr)] string value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_string_contains_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void string_contains_utf8(QueryHandle queryPtr, ColumnKey columnKey,
+                        byte[] value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_string_starts_with_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void string_starts_with_utf8(QueryHandle queryPtr, ColumnKey columnKey,
+                        byte[] value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_string_ends_with_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void string_ends_with_utf8(QueryHandle queryPtr, ColumnKey columnKey,
+                        byte[] value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_string_equal_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void string_equal_utf8(QueryHandle queryPtr, ColumnKey columnKey,
+                        byte[] value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_string_not_equal_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void string_not_equal_utf8(QueryHandle queryPtr, ColumnKey columnKey,
+                        byte[] value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_string_like_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void string_like_utf8(QueryHandle queryPtr, ColumnKey columnKey,
+                        byte[] value, IntPtr valueLen, [MarshalAs(UnmanagedType.I1)] bool caseSensitive, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "query_bool_equal", CallingConvention = CallingConvention.Cdecl)]
             public static extern void bool_equal(QueryHandle queryPtr, ColumnKey columnKey, IntPtr value, out NativeException ex);
 
@@ -206,6 +230,8 @@ public QueryHandle(RealmHandle root, IntPtr handle) : base(root, handle)
         {
         }
 
+        protected override HandleKind? Kind => HandleKind.Query;
+
         protected override void Unbind()
         {
             NativeMethods.destroy(handle);
@@ -295,6 +321,44 @@ public void StringLike(ColumnKey columnKey, string value, bool caseSensitive)
             nativeException.ThrowIfNecessary();
         }
 
+        // The Utf8 variants take strings that are already UTF-8 encoded, saving the conversion from UTF-16 on the native side.
+        // If the user hasn't specified it, caseSensitive should be true.
+        public void StringContainsUtf8(ColumnKey columnKey, byte[] value, bool caseSensitive)
+        {
+            NativeMethods.string_contains_utf8(this, columnKey, value, (IntPtr)value.Length, caseSensitive, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void StringStartsWithUtf8(ColumnKey columnKey, byte[] value, bool caseSensitive)
+        {
+            NativeMethods.string_starts_with_utf8(this, columnKey, value, (IntPtr)value.Length, caseSensitive, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void StringEndsWithUtf8(ColumnKey columnKey, byte[] value, bool caseSensitive)
+        {
+            NativeMethods.string_ends_with_utf8(this, columnKey, value, (IntPtr)value.Length, caseSensitive, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void StringEqualUtf8(ColumnKey columnKey, byte[] value, bool caseSensitive)
+        {
+            NativeMethods.string_equal_utf8(this, columnKey, value, (IntPtr)value.Length, caseSensitive, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void StringNotEqualUtf8(ColumnKey columnKey, byte[] value, bool caseSensitive)
+        {
+            NativeMethods.string_not_equal_utf8(this, columnKey, value, (IntPtr)value.Length, caseSensitive, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
+        public void StringLikeUtf8(ColumnKey columnKey, byte[] value, bool caseSensitive)
+        {
+            NativeMethods.string_like_utf8(this, columnKey, value, (IntPtr)value.Length, caseSensitive, out var nativeException);
+            nativeException.ThrowIfNecessary();
+        }
+
         public void BoolEqual(ColumnKey columnKey, bool value)
         {
             NativeMethods.bool_equal(this, columnKey, MarshalHelpers.BoolToIntPtr(value), out var nativeException);
@@ -20,6 +20,7 @@
 using System.Collections.Generic;
 using System.Globalization;
 using System.Runtime.InteropServices;
+using Realms.Native;
 
 // Replaces IntPtr as a handle to a c++ realm class
 // Using criticalHandle makes the binding more robust with regards to out-of-band exceptions and finalization
@@ -49,6 +50,19 @@ namespace Realms
 {
     internal abstract class RealmHandle : SafeHandle
     {
+        private static class NativeMethods
+        {
+#pragma warning disable IDE1006 // Naming Styles
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "realm_destroy_handles", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy_handles([MarshalAs(UnmanagedType.LPArray), In] HandleKind[] kinds, [MarshalAs(UnmanagedType.LPArray), In] IntPtr[] handles, IntPtr count);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "realm_get_handle_counters", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_handle_counters([MarshalAs(UnmanagedType.LPArray), Out] HandleCounters[] counters, IntPtr count);
+
+#pragma warning restore IDE1006 // Naming Styles
+        }
+
         // Every handle can potentially have an unbind list
         // If the unbind list is instantiated, this handle is a handle for a root object
         // and the unbind list will get filled with handles from finalizer threads
@@ -88,6 +102,13 @@ internal abstract class RealmHandle : SafeHandle
         /// </summary>
         protected abstract void Unbind();
 
+        /// <summary>
+        /// Gets the kind of native handle this is, if it can be destroyed together with others by realm_destroy_handles.
+        /// Handles with a kind that are queued in their root's unbind list are destroyed in a single call rather than
+        /// through Unbind.
+        /// </summary>
+        protected virtual HandleKind? Kind => null;
+
         public override bool IsInvalid => handle == IntPtr.Zero;
 
         //// I am assuming that it is okay to add fields to something derived from CriticalHandle, it is mentioned in the source that it might not be,
@@ -138,7 +159,8 @@ protected RealmHandle(RealmHandle root, IntPtr handle) : base(IntPtr.Zero, true)
         }
 
         // please only call if unbindlist is not null
-        private void LockAndUndbindList()
+        // roots also call this where they know they are on a user thread, so that queued children don't wait for the next child handle
+        protected void LockAndUndbindList()
         {
             if (_unbindList.Count == 0)
             {
@@ -259,12 +281,34 @@ private void UnbindLockedList()
             // put in here in order to save time otherwise spent looping and clearing an empty list
             if (_unbindList.Count > 0)
             {
-                foreach (var realmHandle in _unbindList)
+                UnbindHandles(_unbindList);
+                _unbindList.Clear();
+            }
+        }
+
+        // destroys the handles that have a kind in a single native call, and unbinds the others one by one
+        private static void UnbindHandles(List<RealmHandle> handles)
+        {
+            var kinds = new HandleKind[handles.Count];
+            var nativeHandles = new IntPtr[handles.Count];
+            var count = 0;
+            foreach (var realmHandle in handles)
+            {
+                if (realmHandle.Kind is HandleKind kind)
+                {
+                    kinds[count] = kind;
+                    nativeHandles[count] = realmHandle.handle;
+                    count++;
+                }
+                else
                 {
                     realmHandle.Unbind();
                 }
+            }
 
-                _unbindList.Clear();
+            if (count > 0)
+            {
+                NativeMethods.destroy_handles(kinds, nativeHandles, (IntPtr)count);
             }
         }
 
@@ -273,6 +317,23 @@ public override string ToString()
             return base.ToString() + handle.ToInt64().ToString("x8", CultureInfo.InvariantCulture);
         }
 
+        /// <summary>
+        /// Gets the number of live native handles of every <see cref="HandleKind"/>, and the most there have been at once,
+        /// indexed by kind.
+        /// </summary>
+        public static HandleCounters[] GetHandleCounters()
+        {
+            var counters = new HandleCounters[Enum.GetValues(typeof(HandleKind)).Length];
+            var kinds = (int)NativeMethods.get_handle_counters(counters, (IntPtr)counters.Length);
+            if (kinds > counters.Length)
+            {
+                counters = new HandleCounters[kinds];
+                NativeMethods.get_handle_counters(counters, (IntPtr)kinds);
+            }
+
+            return counters;
+        }
+
         /// <summary>
         /// Called by children to this root, when they would like to
         /// be unbound, but are (possibly) running in a finalizer thread
@@ -287,8 +348,18 @@ private void RequestUnbind(RealmHandle handleToUnbind)
                 // first let's see if we should go to the list or not
                 if (_noMoreUserThread)
                 {
+                    // children are destroyed together with whatever is still queued, and the root after all of them
+                    if (handleToUnbind != this)
+                    {
+                        _unbindList.Add(handleToUnbind);
+                    }
+
                     UnbindLockedList();
-                    handleToUnbind.Unbind();
+
+                    if (handleToUnbind == this)
+                    {
+                        Unbind();
+                    }
                 }
                 else
                 {
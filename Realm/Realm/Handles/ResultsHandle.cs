@@ -1,4 +1,4 @@
-////////////////////////////////////////////////////////////////////////////
+﻿////////////////////////////////////////////////////////////////////////////
 //
 // Copyright 2016 Realm Inc.
 //
@@ -17,8 +17,10 @@
 ////////////////////////////////////////////////////////////////////////////
 
 using System;
+using System.Collections.Generic;
 using System.Runtime.InteropServices;
 using Realms.Native;
+using Realms.Schema;
 
 namespace Realms
 {
@@ -52,6 +54,64 @@ private static class NativeMethods
             public static extern IntPtr get_binary(ResultsHandle results, IntPtr link_ndx, IntPtr buffer, IntPtr bufsize,
                 [MarshalAs(UnmanagedType.I1)] out bool isNull, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_string_view", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_string_view(ResultsHandle results, IntPtr link_ndx, out DataView value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_binary_view", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_binary_view(ResultsHandle results, IntPtr link_ndx, out DataView value, out NativeException ex);
+
+            #endregion
+
+            #region bulk get
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_primitive_range", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_primitive_range(ResultsHandle results, PropertyType type, IntPtr start, IntPtr count, IntPtr values, byte[] null_bitmap,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_strings", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_strings(ResultsHandle results, IntPtr start, IntPtr count, IntPtr buffer, IntPtr buffer_size, [Out] IntPtr[] offsets,
+                [Out] byte[] null_bitmap, out IntPtr required_size, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_column_values", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_column_values(ResultsHandle results, IntPtr property_ndx, IntPtr start, IntPtr count, IntPtr values, byte[] null_bitmap,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_string_column_values", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_string_column_values(ResultsHandle results, IntPtr property_ndx, IntPtr start, IntPtr count, IntPtr buffer, IntPtr buffer_size,
+                [Out] IntPtr[] offsets, [Out] byte[] null_bitmap, out IntPtr required_size, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_keys(ResultsHandle results, IntPtr start, IntPtr count, [Out] ObjectKey[] keys, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_key_path_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_key_path_keys(ResultsHandle results, IntPtr[] property_chain, IntPtr chain_length, IntPtr start, IntPtr count,
+                [Out] ObjectKey[] keys, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_key_path_primitives", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_key_path_primitives(ResultsHandle results, IntPtr[] property_chain, IntPtr chain_length, IntPtr start, IntPtr count,
+                [In, Out] PrimitiveValue[] values, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_backlink_counts", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_backlink_counts(ResultsHandle results, IntPtr property_ndx, IntPtr start, IntPtr count, [Out] IntPtr[] counts,
+                out NativeException ex);
+
+            #endregion
+
+            #region aggregates
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_aggregate", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void aggregate(ResultsHandle results, IntPtr property_ndx, AggregateType type, ref PrimitiveValue value, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_parallel_aggregate", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void parallel_aggregate(ResultsHandle results, IntPtr property_ndx, IntPtr thread_count, out AggregateSummary summary,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_group_by", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr group_by(ResultsHandle results, IntPtr key_property_ndx, Int64 bucket_ticks, GroupAggregateSpec[] aggregates,
+                IntPtr aggregates_count, out NativeException ex);
+
             #endregion
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_count", CallingConvention = CallingConvention.Cdecl)]
@@ -79,6 +139,10 @@ private static class NativeMethods
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_filtered_results", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_filtered_results(ResultsHandle results, [MarshalAs(UnmanagedType.LPWStr)] string query_buf, IntPtr query_len, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_get_filtered_results_with_arguments", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_filtered_results_with_arguments(ResultsHandle results, [MarshalAs(UnmanagedType.LPWStr)] string query_buf, IntPtr query_len,
+                [In] PropertyValue[] arguments, IntPtr arguments_count, byte[] arena, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "results_find_object", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr find_object(ResultsHandle results, ObjectHandle objectHandle, out NativeException ex);
 
@@ -118,6 +182,8 @@ public ResultsHandle(RealmHandle root, IntPtr handle) : base(root, handle)
         {
         }
 
+        protected override HandleKind? Kind => HandleKind.Results;
+
         protected override void Unbind()
         {
             NativeMethods.destroy(handle);
@@ -143,6 +209,107 @@ public override byte[] GetByteArrayAtIndex(int index)
                 NativeMethods.get_binary(this, (IntPtr)index, buffer, bufferLength, out isNull, out ex));
         }
 
+        protected override IntPtr GetPrimitiveRangeCore(PropertyType type, IntPtr start, IntPtr count, IntPtr values, byte[] nullBitmap, out NativeException nativeException) =>
+            NativeMethods.get_primitive_range(this, type, start, count, values, nullBitmap, out nativeException);
+
+        protected override IntPtr GetStringsCore(IntPtr start, IntPtr count, IntPtr buffer, IntPtr bufferSize, IntPtr[] offsets, byte[] nullBitmap,
+            out IntPtr requiredSize, out NativeException nativeException) =>
+            NativeMethods.get_strings(this, start, count, buffer, bufferSize, offsets, nullBitmap, out requiredSize, out nativeException);
+
+        protected override bool GetStringViewCore(IntPtr index, out DataView view, out NativeException nativeException) =>
+            NativeMethods.get_string_view(this, index, out view, out nativeException);
+
+        protected override bool GetByteArrayViewCore(IntPtr index, out DataView view, out NativeException nativeException) =>
+            NativeMethods.get_binary_view(this, index, out view, out nativeException);
+
+        #endregion
+
+        #region Bulk get
+
+        // Reads the property at propertyIndex, of the given type, of up to count objects starting at start.
+        public T[] GetColumnValues<T>(IntPtr propertyIndex, PropertyType type, int start, int count)
+        {
+            return MarshalHelpers.GetPrimitives<T>(type, count, (IntPtr values, byte[] nullBitmap, out NativeException ex) =>
+                NativeMethods.get_column_values(this, propertyIndex, (IntPtr)start, (IntPtr)count, values, nullBitmap, out ex));
+        }
+
+        public string[] GetStringColumnValues(IntPtr propertyIndex, int start, int count)
+        {
+            return MarshalHelpers.GetStrings(start, count, (IntPtr from, IntPtr remaining, IntPtr buffer, IntPtr bufferSize, IntPtr[] offsets, byte[] nullBitmap,
+                out IntPtr requiredSize, out NativeException ex) =>
+                NativeMethods.get_string_column_values(this, propertyIndex, from, remaining, buffer, bufferSize, offsets, nullBitmap, out requiredSize, out ex));
+        }
+
+        public ObjectKey[] GetKeys(int start, int count)
+        {
+            var keys = new ObjectKey[count];
+            var read = NativeMethods.get_keys(this, (IntPtr)start, (IntPtr)count, keys, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            Array.Resize(ref keys, (int)read);
+            return keys;
+        }
+
+        // Follows the links of propertyChain from each object and returns the keys of the objects it ends at,
+        // which are null where a link along the way is.
+        public ObjectKey[] GetKeyPathKeys(IntPtr[] propertyChain, int start, int count)
+        {
+            var keys = new ObjectKey[count];
+            var read = NativeMethods.get_key_path_keys(this, propertyChain, (IntPtr)propertyChain.Length, (IntPtr)start, (IntPtr)count, keys, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            Array.Resize(ref keys, (int)read);
+            return keys;
+        }
+
+        public PrimitiveValue[] GetKeyPathPrimitives(IntPtr[] propertyChain, int start, int count)
+        {
+            var values = new PrimitiveValue[count];
+            var read = NativeMethods.get_key_path_primitives(this, propertyChain, (IntPtr)propertyChain.Length, (IntPtr)start, (IntPtr)count, values, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            Array.Resize(ref values, (int)read);
+            return values;
+        }
+
+        public int[] GetBacklinkCounts(IntPtr propertyIndex, int start, int count)
+        {
+            var counts = new IntPtr[count];
+            var read = (int)NativeMethods.get_backlink_counts(this, propertyIndex, (IntPtr)start, (IntPtr)count, counts, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            var result = new int[read];
+            for (var i = 0; i < read; i++)
+            {
+                result[i] = (int)counts[i];
+            }
+
+            return result;
+        }
+
+        #endregion
+
+        #region Aggregates
+
+        protected override void AggregateCore(IntPtr propertyIndex, AggregateType type, ref PrimitiveValue result, out NativeException nativeException) =>
+            NativeMethods.aggregate(this, propertyIndex, type, ref result, out nativeException);
+
+        // Only frozen results can be aggregated on several threads. A threadCount of 0 uses one thread per core.
+        public AggregateSummary ParallelAggregate(IntPtr propertyIndex, int threadCount = 0)
+        {
+            NativeMethods.parallel_aggregate(this, propertyIndex, (IntPtr)threadCount, out var summary, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return summary;
+        }
+
+        // Dates are grouped by buckets of bucket, or by their exact value if it is zero.
+        public GroupByResultHandle GroupBy(IntPtr keyPropertyIndex, TimeSpan bucket, GroupAggregateSpec[] aggregates)
+        {
+            var result = NativeMethods.group_by(this, keyPropertyIndex, bucket.Ticks, aggregates, (IntPtr)aggregates.Length, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return new GroupByResultHandle(Root ?? this, result);
+        }
+
         #endregion
 
         public override int Count()
@@ -228,6 +395,15 @@ public override ResultsHandle GetFilteredResults(string query)
             return new ResultsHandle(this, ptr);
         }
 
+        // $0, $1, ... in query are bound to arguments, which are passed as their own type - see PropertyValue.Create.
+        public ResultsHandle GetFilteredResults(string query, IList<object> arguments)
+        {
+            var values = PropertyValue.Create(arguments, out var arena);
+            var ptr = NativeMethods.get_filtered_results_with_arguments(this, query, (IntPtr)query.Length, values, (IntPtr)values.Length, arena, out var ex);
+            ex.ThrowIfNecessary();
+            return new ResultsHandle(this, ptr);
+        }
+
         public int Find(ObjectHandle objectHandle)
         {
             var result = NativeMethods.find_object(this, objectHandle, out var nativeException);
@@ -119,6 +119,18 @@ private static class NativeMethods
                                                              [MarshalAs(UnmanagedType.I1)] bool update,
                                                              [MarshalAs(UnmanagedType.I1)] out bool is_new, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_create_object_string_unique_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr create_object_unique_utf8(SharedRealmHandle sharedRealm, TableHandle table,
+                                                                  byte[] value, IntPtr valueLen,
+                                                                  [MarshalAs(UnmanagedType.I1)] bool update,
+                                                                  [MarshalAs(UnmanagedType.I1)] out bool is_new, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "realm_traverse_links", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr traverse_links(SharedRealmHandle sharedRealm, TableHandle start_table,
+                [MarshalAs(UnmanagedType.LPArray), In] ObjectKey[] start_keys, IntPtr start_count,
+                [MarshalAs(UnmanagedType.LPArray), In] TraversalEdge[] edges, IntPtr edges_count,
+                IntPtr max_depth, [MarshalAs(UnmanagedType.I1)] bool deduplicate, IntPtr max_results, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "shared_realm_get_schema", CallingConvention = CallingConvention.Cdecl)]
             public static extern void get_schema(SharedRealmHandle sharedRealm, IntPtr callback, out NativeException ex);
 
@@ -210,6 +222,8 @@ public IntPtr GetManagedStateHandle()
 
         public void BeginTransaction()
         {
+            LockAndUndbindList();
+
             NativeMethods.begin_transaction(this, out var nativeException);
             nativeException.ThrowIfNecessary();
         }
@@ -235,6 +249,8 @@ public bool IsInTransaction()
 
         public bool Refresh()
         {
+            LockAndUndbindList();
+
             var result = NativeMethods.refresh(this, out var nativeException);
             nativeException.ThrowIfNecessary();
             return result;
@@ -344,6 +360,25 @@ public ObjectHandle CreateObjectWithPrimaryKey(Property pkProperty, object prima
             }
         }
 
+        // Creates an object with a string primary key that is already UTF-8 encoded. A null key is a null primary key.
+        public ObjectHandle CreateObjectWithPrimaryKeyUtf8(TableHandle table, byte[] key, bool update, out bool isNew)
+        {
+            var result = NativeMethods.create_object_unique_utf8(this, table, key, (IntPtr)(key?.Length ?? 0), update, out isNew, out var ex);
+            ex.ThrowIfNecessary();
+            return new ObjectHandle(this, result);
+        }
+
+        // Walks the object graph from the objects with startKeys in startTable, following edges up to maxDepth links away.
+        // Objects are reported once if deduplicate is set and every time they are reached otherwise. A maxResults of 0
+        // means no limit. The tables of edges must be kept alive until this returns.
+        public TraversalResultHandle TraverseLinks(TableHandle startTable, ObjectKey[] startKeys, TraversalEdge[] edges, int maxDepth, bool deduplicate, int maxResults = 0)
+        {
+            var result = NativeMethods.traverse_links(this, startTable, startKeys, (IntPtr)startKeys.Length, edges, (IntPtr)edges.Length,
+                (IntPtr)maxDepth, deduplicate, (IntPtr)maxResults, out var ex);
+            ex.ThrowIfNecessary();
+            return new TraversalResultHandle(this, result);
+        }
+
         public bool HasChanged()
         {
             return NativeMethods.has_changed(this);
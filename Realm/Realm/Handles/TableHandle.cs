@@ -48,12 +48,29 @@ private static class NativeMethods
             public static extern IntPtr get_object_for_string_primarykey(TableHandle handle, SharedRealmHandle realmHandle,
                 [MarshalAs(UnmanagedType.LPWStr)] string value, IntPtr valueLen, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "table_get_object_for_string_primarykey_utf8", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_object_for_string_primarykey_utf8(TableHandle handle, SharedRealmHandle realmHandle,
+                byte[] value, IntPtr valueLen, out NativeException ex);
+
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "table_get_object_for_int_primarykey", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_object_for_int_primarykey(TableHandle handle, SharedRealmHandle realmHandle, Int64 value, out NativeException ex);
 
             [DllImport(InteropConfig.DLL_NAME, EntryPoint = "table_get_object_for_null_primarykey", CallingConvention = CallingConvention.Cdecl)]
             public static extern IntPtr get_object_for_null_primarykey(TableHandle handle, SharedRealmHandle realmHandle, out NativeException ex);
 
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "table_get_primitive", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void get_primitive(TableHandle table, SharedRealmHandle realm, ObjectKey objectKey, IntPtr propertyIndex, ref PrimitiveValue value,
+                out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "table_get_string", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_string(TableHandle table, SharedRealmHandle realm, ObjectKey objectKey, IntPtr propertyIndex,
+                IntPtr buffer, IntPtr bufsize, [MarshalAs(UnmanagedType.I1)] out bool isNull, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "table_get_link_key", CallingConvention = CallingConvention.Cdecl)]
+            [return: MarshalAs(UnmanagedType.I1)]
+            public static extern bool get_link_key(TableHandle table, SharedRealmHandle realm, ObjectKey objectKey, IntPtr propertyIndex, out ObjectKey targetKey,
+                out NativeException ex);
+
 #pragma warning restore IDE1006 // Naming Styles
 #pragma warning restore SA1121 // Use built-in type alias
         }
@@ -131,6 +148,31 @@ public bool TryFind(SharedRealmHandle realmHandle, string id, out ObjectHandle o
             return true;
         }
 
+        // Looks up a string primary key that is already UTF-8 encoded.
+        public bool TryFindUtf8(SharedRealmHandle realmHandle, byte[] id, out ObjectHandle objectHandle)
+        {
+            NativeException nativeException;
+            IntPtr result;
+            if (id == null)
+            {
+                result = NativeMethods.get_object_for_null_primarykey(this, realmHandle, out nativeException);
+            }
+            else
+            {
+                result = NativeMethods.get_object_for_string_primarykey_utf8(this, realmHandle, id, (IntPtr)id.Length, out nativeException);
+            }
+
+            nativeException.ThrowIfNecessary();
+            if (result == IntPtr.Zero)
+            {
+                objectHandle = null;
+                return false;
+            }
+
+            objectHandle = new ObjectHandle(realmHandle, result);
+            return true;
+        }
+
         public bool TryFind(SharedRealmHandle realmHandle, long? id, out ObjectHandle objectHandle)
         {
             NativeException nativeException;
@@ -154,5 +196,28 @@ public bool TryFind(SharedRealmHandle realmHandle, long? id, out ObjectHandle ob
             objectHandle = new ObjectHandle(realmHandle, result);
             return true;
         }
+
+        // The methods below read a property of the object with objectKey without creating an ObjectHandle for it,
+        // which makes them cheaper for reading many objects.
+        public PrimitiveValue GetPrimitive(SharedRealmHandle realmHandle, ObjectKey objectKey, IntPtr propertyIndex)
+        {
+            var result = new PrimitiveValue();
+            NativeMethods.get_primitive(this, realmHandle, objectKey, propertyIndex, ref result, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return result;
+        }
+
+        public string GetString(SharedRealmHandle realmHandle, ObjectKey objectKey, IntPtr propertyIndex)
+        {
+            return MarshalHelpers.GetString((IntPtr buffer, IntPtr length, out bool isNull, out NativeException ex) =>
+                NativeMethods.get_string(this, realmHandle, objectKey, propertyIndex, buffer, length, out isNull, out ex));
+        }
+
+        public bool TryGetLinkKey(SharedRealmHandle realmHandle, ObjectKey objectKey, IntPtr propertyIndex, out ObjectKey targetKey)
+        {
+            var result = NativeMethods.get_link_key(this, realmHandle, objectKey, propertyIndex, out targetKey, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return result;
+        }
     }
 }
\ No newline at end of file
@@ -46,6 +46,9 @@ public ThreadSafeReferenceHandle(IntPtr handle, bool isRealmReference = false) :
             _isRealmReference = isRealmReference;
         }
 
+        // realm references are destroyed through their own entry point, so only the others can be batched
+        protected override HandleKind? Kind => _isRealmReference ? (HandleKind?)null : HandleKind.ThreadSafeReference;
+
         protected override unsafe void Unbind()
         {
             // This is a bit awkward because ThreadSafeReference<Realm> doesn't inherit from ThreadSafeReferenceBase
@@ -0,0 +1,95 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+using Realms.Native;
+
+namespace Realms
+{
+    internal class TraversalResultHandle : RealmHandle
+    {
+        private static class NativeMethods
+        {
+#pragma warning disable IDE1006 // Naming Styles
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "traversal_result_destroy", CallingConvention = CallingConvention.Cdecl)]
+            public static extern void destroy(IntPtr result);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "traversal_result_get_table_count", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_table_count(TraversalResultHandle result, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "traversal_result_get_table", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_table(TraversalResultHandle result, IntPtr table_ndx, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "traversal_result_get_key_count", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_key_count(TraversalResultHandle result, IntPtr table_ndx, out NativeException ex);
+
+            [DllImport(InteropConfig.DLL_NAME, EntryPoint = "traversal_result_get_keys", CallingConvention = CallingConvention.Cdecl)]
+            public static extern IntPtr get_keys(TraversalResultHandle result, IntPtr table_ndx, IntPtr start, IntPtr count, [Out] ObjectKey[] keys,
+                out NativeException ex);
+
+#pragma warning restore IDE1006 // Naming Styles
+        }
+
+        public TraversalResultHandle(RealmHandle root, IntPtr handle) : base(root, handle)
+        {
+        }
+
+        public int TableCount
+        {
+            get
+            {
+                var result = NativeMethods.get_table_count(this, out var nativeException);
+                nativeException.ThrowIfNecessary();
+                return (int)result;
+            }
+        }
+
+        public TableHandle GetTable(int tableIndex)
+        {
+            var result = NativeMethods.get_table(this, (IntPtr)tableIndex, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return new TableHandle(Root ?? this, result);
+        }
+
+        public int GetKeyCount(int tableIndex)
+        {
+            var result = NativeMethods.get_key_count(this, (IntPtr)tableIndex, out var nativeException);
+            nativeException.ThrowIfNecessary();
+            return (int)result;
+        }
+
+        // The keys of the objects reached in the table at tableIndex, in the order they were reached.
+        public ObjectKey[] GetKeys(int tableIndex)
+        {
+            var count = GetKeyCount(tableIndex);
+            var keys = new ObjectKey[count];
+            var read = (int)NativeMethods.get_keys(this, (IntPtr)tableIndex, IntPtr.Zero, (IntPtr)count, keys, out var nativeException);
+            nativeException.ThrowIfNecessary();
+
+            Array.Resize(ref keys, read);
+            return keys;
+        }
+
+        protected override void Unbind()
+        {
+            NativeMethods.destroy(handle);
+        }
+    }
+}
@@ -31,6 +31,17 @@ namespace Realms
 {
     internal class RealmResultsVisitor : ExpressionVisitor
     {
+        // The built-in numeric conversions that never lower a value, from each type to the ones it widens to.
+        private static readonly Dictionary<Type, Type[]> _wideningConversions = new Dictionary<Type, Type[]>
+        {
+            [typeof(char)] = new[] { typeof(int), typeof(long), typeof(float), typeof(double) },
+            [typeof(byte)] = new[] { typeof(short), typeof(int), typeof(long), typeof(float), typeof(double) },
+            [typeof(short)] = new[] { typeof(int), typeof(long), typeof(float), typeof(double) },
+            [typeof(int)] = new[] { typeof(long), typeof(float), typeof(double) },
+            [typeof(long)] = new[] { typeof(float), typeof(double) },
+            [typeof(float)] = new[] { typeof(double) },
+        };
+
         private readonly Realm _realm;
         private readonly RealmObject.Metadata _metadata;
 
@@ -75,6 +86,8 @@ internal static class String
 
                 internal static readonly LazyMethod EqualsStringComparison = Capture<string>(s => s.Equals(string.Empty, StringComparison.Ordinal));
             }
+
+            internal static readonly LazyMethod AggregateValue = Capture<PrimitiveValue>(v => GetAggregateValue<int>(v));
         }
 
         internal RealmResultsVisitor(Realm realm, RealmObject.Metadata metadata)
@@ -83,6 +96,28 @@ internal RealmResultsVisitor(Realm realm, RealmObject.Metadata metadata)
             _metadata = metadata;
         }
 
+        private static bool TryGetAggregateType(string methodName, out AggregateType type)
+        {
+            switch (methodName)
+            {
+                case nameof(Queryable.Sum):
+                    type = AggregateType.Sum;
+                    return true;
+                case nameof(Queryable.Min):
+                    type = AggregateType.Min;
+                    return true;
+                case nameof(Queryable.Max):
+                    type = AggregateType.Max;
+                    return true;
+                case nameof(Queryable.Average):
+                    type = AggregateType.Average;
+                    return true;
+                default:
+                    type = default;
+                    return false;
+            }
+        }
+
         private static Expression StripQuotes(Expression e)
         {
             while (e.NodeType == ExpressionType.Quote)
@@ -150,6 +185,94 @@ private IntPtr[] TraverseSort(MemberExpression expression)
             return chain.ToArray();
         }
 
+        // Sum, Min, Max and Average of a property are computed by core rather than by enumerating the results.
+        private Expression RunAggregate(MethodCallExpression node, AggregateType type)
+        {
+            Visit(node.Arguments[0]);
+
+            var body = ((LambdaExpression)StripQuotes(node.Arguments[1])).Body;
+
+            // e.g. Max(p => (long?)p.IntProperty) - core aggregates the property itself and the result is converted below,
+            // so only conversions that give the same result either way are allowed
+            if (body.NodeType == ExpressionType.Convert)
+            {
+                var convert = (UnaryExpression)body;
+                if (!IsAggregatePreserving(convert, type))
+                {
+                    throw new NotSupportedException($"The selector of {node.Method.Name} can't convert the property from {convert.Operand.Type.Name} to {convert.Type.Name}.\nUnable to process '{body}'.");
+                }
+
+                body = convert.Operand;
+            }
+
+            if (!(body is MemberExpression member) ||
+                member.Expression?.NodeType != ExpressionType.Parameter ||
+                !_metadata.PropertyIndices.TryGetValue(GetColumnName(member), out var propertyIndex))
+            {
+                throw new NotSupportedException($"The selector of {node.Method.Name} must be a direct access to a persisted property in Realm.\nUnable to process '{body}'.");
+            }
+
+            PrimitiveValue result;
+            using (var rh = MakeResultsForQuery())
+            {
+                result = rh.Aggregate(propertyIndex, type);
+            }
+
+            if (!result.has_value)
+            {
+                // like Enumerable, the sum of no values is 0, even for nullable properties
+                var underlyingType = Nullable.GetUnderlyingType(node.Type);
+                if (type == AggregateType.Sum)
+                {
+                    return Expression.Constant(Activator.CreateInstance(underlyingType ?? node.Type), node.Type);
+                }
+
+                if (node.Type.IsClass || underlyingType != null)
+                {
+                    return Expression.Constant(null, node.Type);
+                }
+
+                throw new InvalidOperationException("Sequence contains no elements");
+            }
+
+            var value = Methods.AggregateValue.Value.MakeGenericMethod(node.Type).Invoke(null, new object[] { result });
+            return Expression.Constant(value, node.Type);
+        }
+
+        private static T GetAggregateValue<T>(PrimitiveValue value) => value.Get<T>();
+
+        // Whether aggregating the property and then converting the result is the same as aggregating the converted values.
+        // That holds for identity and lifting to Nullable. Widening keeps the order of values, so it also holds for Min and Max,
+        // but Sum and Average of the wider type could differ through overflow or rounding.
+        private static bool IsAggregatePreserving(UnaryExpression convert, AggregateType type)
+        {
+            if (convert.Method != null)
+            {
+                return false;
+            }
+
+            var fromType = Nullable.GetUnderlyingType(convert.Operand.Type);
+            var toType = Nullable.GetUnderlyingType(convert.Type);
+
+            // unwrapping a Nullable would throw on null, which core skips
+            if (fromType != null && toType == null)
+            {
+                return false;
+            }
+
+            fromType = fromType ?? convert.Operand.Type;
+            toType = toType ?? convert.Type;
+
+            if (fromType == toType)
+            {
+                return true;
+            }
+
+            return (type == AggregateType.Min || type == AggregateType.Max) &&
+                   _wideningConversions.TryGetValue(fromType, out var widerTypes) &&
+                   widerTypes.Contains(toType);
+        }
+
         [SuppressMessage("Reliability", "CA2000:Dispose objects before losing scope", Justification = "The RealmObject instance will own its handle.")]
         protected override Expression VisitMethodCall(MethodCallExpression node)
         {
@@ -184,6 +307,11 @@ protected override Expression VisitMethodCall(MethodCallExpression node)
                     return Expression.Constant(foundCount);
                 }
 
+                if (node.Arguments.Count == 2 && TryGetAggregateType(node.Method.Name, out var aggregateType))
+                {
+                    return RunAggregate(node, aggregateType);
+                }
+
                 if (node.Method.Name == nameof(Queryable.Any))
                 {
                     RecurseToWhereOrRunLambda(node);
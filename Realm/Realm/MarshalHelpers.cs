@@ -17,9 +17,11 @@
 ////////////////////////////////////////////////////////////////////////////
 
 using System;
+using System.Collections.Generic;
 using System.Diagnostics;
 using System.Runtime.InteropServices;
-using Realms.Exceptions;
+using Realms.Native;
+using Realms.Schema;
 
 namespace Realms
 {
@@ -53,11 +55,6 @@ public static string GetString(NativeCollectionGetter getter)
                 var bytesRead = (int)getter(stringGetBuffer, (IntPtr)bufferSize, out var isNull, out var nativeException);
                 nativeException.ThrowIfNecessary();
 
-                if (bytesRead == -1)
-                {
-                    throw new RealmInvalidDatabaseException("Corrupted string data");
-                }
-
                 // need a bigger buffer
                 if (bytesRead > bufferSize)
                 {
@@ -70,12 +67,6 @@ public static string GetString(NativeCollectionGetter getter)
                     bytesRead = (int)getter(stringGetBuffer, (IntPtr)bufferSize, out isNull, out nativeException);
                     nativeException.ThrowIfNecessary();
 
-                    // bad UTF-8 in full string
-                    if (bytesRead == -1)
-                    {
-                        throw new RealmInvalidDatabaseException("Corrupted string data");
-                    }
-
                     Debug.Assert(bytesRead <= bufferSize, "Buffer must have overflowed.");
                 } // needed re-read with expanded buffer
 
@@ -164,5 +155,174 @@ public static T[] GetCollection<T>(NativeCollectionGetter<T> getter, int bufferS
             Array.Resize(ref buffer, itemsRead);
             return buffer;
         }
+
+        public delegate IntPtr NativePrimitiveRangeGetter(IntPtr values, byte[] nullBitmap, out NativeException ex);
+
+        public delegate void NativePrimitiveRangeSetter(IntPtr values, byte[] nullBitmap, out NativeException ex);
+
+        public delegate IntPtr NativeStringRangeGetter(IntPtr start, IntPtr count, IntPtr buffer, IntPtr bufferSize, IntPtr[] offsets, byte[] nullBitmap,
+            out IntPtr requiredSize, out NativeException ex);
+
+        // The size of a single element of the arrays the bulk primitive functions read and write.
+        // Ints and dates (as ticks) are 64 bit, bools a single byte.
+        private static int GetPrimitiveSize(PropertyType type)
+        {
+            switch (type.UnderlyingType())
+            {
+                case PropertyType.Bool:
+                    return sizeof(bool);
+                case PropertyType.Int:
+                case PropertyType.Date:
+                case PropertyType.Double:
+                    return sizeof(long);
+                case PropertyType.Float:
+                    return sizeof(float);
+                default:
+                    throw new NotSupportedException($"PrimitiveType {type} is not supported.");
+            }
+        }
+
+        /// <summary>
+        /// Reads up to count values of type with a single call to getter, which fills the values and null bitmap
+        /// it is given and returns the number of values it read.
+        /// </summary>
+        public static unsafe T[] GetPrimitives<T>(PropertyType type, int count, NativePrimitiveRangeGetter getter)
+        {
+            var values = new byte[Math.Max(count, 1) * GetPrimitiveSize(type)];
+            var nullBitmap = new byte[(count / 8) + 1];
+
+            int read;
+            NativeException nativeException;
+            fixed (byte* valuesPtr = values)
+            {
+                read = (int)getter((IntPtr)valuesPtr, nullBitmap, out nativeException);
+            }
+
+            nativeException.ThrowIfNecessary();
+
+            var result = new T[read];
+            fixed (byte* valuesPtr = values)
+            {
+                for (var i = 0; i < read; i++)
+                {
+                    var value = new PrimitiveValue
+                    {
+                        type = type,
+                        has_value = (nullBitmap[i / 8] & (1 << (i % 8))) == 0
+                    };
+
+                    switch (type.UnderlyingType())
+                    {
+                        case PropertyType.Bool:
+                            value.bool_value = ((bool*)valuesPtr)[i];
+                            break;
+                        case PropertyType.Float:
+                            value.float_value = ((float*)valuesPtr)[i];
+                            break;
+                        case PropertyType.Double:
+                            value.double_value = ((double*)valuesPtr)[i];
+                            break;
+                        default:
+                            value.int_value = ((long*)valuesPtr)[i];
+                            break;
+                    }
+
+                    result[i] = value.Get<T>();
+                }
+            }
+
+            return result;
+        }
+
+        /// <summary>
+        /// Packs values as type, the way the bulk primitive setters expect them, and passes them to setter.
+        /// </summary>
+        public static unsafe void SetPrimitives<T>(PropertyType type, IList<T> values, NativePrimitiveRangeSetter setter)
+        {
+            var packed = new byte[Math.Max(values.Count, 1) * GetPrimitiveSize(type)];
+            var nullBitmap = new byte[(values.Count / 8) + 1];
+
+            NativeException nativeException;
+            fixed (byte* valuesPtr = packed)
+            {
+                for (var i = 0; i < values.Count; i++)
+                {
+                    var value = PrimitiveValue.Create(values[i], type);
+                    if (!value.has_value)
+                    {
+                        nullBitmap[i / 8] |= (byte)(1 << (i % 8));
+                    }
+
+                    switch (type.UnderlyingType())
+                    {
+                        case PropertyType.Bool:
+                            ((bool*)valuesPtr)[i] = value.bool_value;
+                            break;
+                        case PropertyType.Float:
+                            ((float*)valuesPtr)[i] = value.float_value;
+                            break;
+                        case PropertyType.Double:
+                            ((double*)valuesPtr)[i] = value.double_value;
+                            break;
+                        default:
+                            ((long*)valuesPtr)[i] = value.int_value;
+                            break;
+                    }
+                }
+
+                setter((IntPtr)valuesPtr, nullBitmap, out nativeException);
+            }
+
+            nativeException.ThrowIfNecessary();
+        }
+
+        /// <summary>
+        /// Reads up to count strings starting at start, calling getter again with a larger buffer, or from where it
+        /// stopped, until they have all been read or the end of the collection is reached.
+        /// </summary>
+        public static unsafe string[] GetStrings(int start, int count, NativeStringRangeGetter getter)
+        {
+            var result = new List<string>(count);
+            var bufferSize = Math.Max(count * 16, 128);
+            var offsets = new IntPtr[count + 1];
+            var nullBitmap = new byte[(count / 8) + 1];
+
+            while (result.Count < count)
+            {
+                var remaining = count - result.Count;
+                var buffer = new char[bufferSize];
+
+                int packed;
+                IntPtr requiredSize;
+                NativeException nativeException;
+                fixed (char* bufferPtr = buffer)
+                {
+                    packed = (int)getter((IntPtr)(start + result.Count), (IntPtr)remaining, (IntPtr)bufferPtr, (IntPtr)bufferSize, offsets, nullBitmap,
+                        out requiredSize, out nativeException);
+                }
+
+                nativeException.ThrowIfNecessary();
+
+                for (var i = 0; i < packed; i++)
+                {
+                    var isNull = (nullBitmap[i / 8] & (1 << (i % 8))) != 0;
+                    var offset = (int)offsets[i];
+                    result.Add(isNull ? null : new string(buffer, offset, (int)offsets[i + 1] - offset));
+                }
+
+                if (packed < remaining)
+                {
+                    // either the end of the collection was reached or the next string didn't fit
+                    if ((int)requiredSize <= bufferSize)
+                    {
+                        break;
+                    }
+
+                    bufferSize = (int)requiredSize;
+                }
+            }
+
+            return result.ToArray();
+        }
     }
 }
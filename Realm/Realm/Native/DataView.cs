@@ -0,0 +1,35 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    /// <summary>
+    /// A string or binary value pointing straight into the Realm file. It is only valid until the
+    /// Realm advances to another version, so it must be copied before control returns to the user.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct DataView
+    {
+        public byte* data;
+
+        public IntPtr size;
+    }
+}
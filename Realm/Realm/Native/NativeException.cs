@@ -32,15 +32,23 @@ internal unsafe struct NativeException
         public byte* detailBytes;
         public IntPtr detailLength;
 
+        // Non-zero when the messages live in storage owned by the wrappers rather than being allocated
+        // for us to free. A byte rather than a bool so that the struct stays blittable.
+        public byte messagesPreallocated;
+
         internal Exception Convert(Func<RealmExceptionCodes, Exception> overrider = null)
         {
             var message = (messageLength != IntPtr.Zero) ?
                             Encoding.UTF8.GetString(messageBytes, (int)messageLength)
                             : "No further information available";
-            NativeCommon.delete_pointer(messageBytes);
 
             var detail = (detailLength != IntPtr.Zero) ? Encoding.UTF8.GetString(detailBytes, (int)detailLength) : null;
-            NativeCommon.delete_pointer(detailBytes);
+
+            if (messagesPreallocated == 0)
+            {
+                NativeCommon.delete_pointer(messageBytes);
+                NativeCommon.delete_pointer(detailBytes);
+            }
 
             return overrider?.Invoke(type) ?? RealmException.Create(type, message, detail);
         }
@@ -26,6 +26,16 @@ internal struct ObjectKey : IEquatable<ObjectKey>
     {
         private Int64 value;
 
+        internal ObjectKey(Int64 value)
+        {
+            this.value = value;
+        }
+
+        internal Int64 Value => value;
+
+        // core's null key, used for links that aren't set
+        internal bool IsNull => value == -1;
+
         public bool Equals(ObjectKey other) => value.Equals(other.value);
 
         public override bool Equals(object obj)
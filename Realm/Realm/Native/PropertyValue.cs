@@ -0,0 +1,211 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Collections.Generic;
+using System.IO;
+using System.Runtime.InteropServices;
+using System.Text;
+using Realms.Schema;
+
+namespace Realms.Native
+{
+    /// <summary>
+    /// Where a string or binary value of a <see cref="PropertyValue"/> lives in the arena passed alongside it.
+    /// The offset is in bytes. The size is in UTF-16 code units for strings and in bytes for binaries.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct ArenaValue
+    {
+        public IntPtr offset;
+
+        public IntPtr size;
+    }
+
+    /// <summary>
+    /// A single property of an object, exchanged in bulk with the object_*_properties functions, or an
+    /// argument of a query. Dates are ticks and links the key of the target object.
+    /// </summary>
+    [StructLayout(LayoutKind.Explicit)]
+    internal struct PropertyValue
+    {
+        /// <summary>
+        /// What <see cref="Get"/> returns for list properties, which aren't read in bulk. It can't be mistaken for a
+        /// value, including null.
+        /// </summary>
+        public static readonly object ListPlaceholder = new object();
+
+        [FieldOffset(0)]
+        [MarshalAs(UnmanagedType.U1)]
+        internal PropertyType type;
+
+        [FieldOffset(1)]
+        [MarshalAs(UnmanagedType.I1)]
+        internal bool has_value;
+
+        [FieldOffset(8)]
+        [MarshalAs(UnmanagedType.I1)]
+        internal bool bool_value;
+
+        [FieldOffset(8)]
+        internal long int_value;
+
+        [FieldOffset(8)]
+        internal float float_value;
+
+        [FieldOffset(8)]
+        internal double double_value;
+
+        [FieldOffset(8)]
+        internal ArenaValue arena_value;
+
+        /// <summary>
+        /// Packs values into an array of <see cref="PropertyValue"/> and the arena their strings and binaries are
+        /// copied into. The type of each value is taken from its .NET type - whole numbers are ints, links are given
+        /// by their <see cref="ObjectKey"/> and nulls have no value.
+        /// </summary>
+        public static PropertyValue[] Create(IList<object> values, out byte[] arena)
+        {
+            var result = new PropertyValue[values.Count];
+            using (var stream = new MemoryStream())
+            {
+                for (var i = 0; i < values.Count; i++)
+                {
+                    result[i] = Create(values[i], stream);
+                }
+
+                arena = stream.ToArray();
+            }
+
+            return result;
+        }
+
+        private static PropertyValue Create(object value, MemoryStream arena)
+        {
+            var result = new PropertyValue
+            {
+                has_value = value != null
+            };
+
+            switch (value)
+            {
+                case null:
+                    break;
+                case bool boolValue:
+                    result.type = PropertyType.Bool;
+                    result.bool_value = boolValue;
+                    break;
+                case byte _:
+                case short _:
+                case int _:
+                case long _:
+                    result.type = PropertyType.Int;
+                    result.int_value = Convert.ToInt64(value);
+                    break;
+                case float floatValue:
+                    result.type = PropertyType.Float;
+                    result.float_value = floatValue;
+                    break;
+                case double doubleValue:
+                    result.type = PropertyType.Double;
+                    result.double_value = doubleValue;
+                    break;
+                case DateTimeOffset dateValue:
+                    result.type = PropertyType.Date;
+                    result.int_value = dateValue.ToUniversalTime().Ticks;
+                    break;
+                case ObjectKey keyValue:
+                    result.type = PropertyType.Object;
+                    result.int_value = keyValue.Value;
+                    break;
+                case string stringValue:
+                    // strings are read as UTF-16 so they need to be aligned
+                    if (arena.Length % 2 != 0)
+                    {
+                        arena.WriteByte(0);
+                    }
+
+                    result.type = PropertyType.String;
+                    result.arena_value = Write(arena, Encoding.Unicode.GetBytes(stringValue), stringValue.Length);
+                    break;
+                case byte[] binaryValue:
+                    result.type = PropertyType.Data;
+                    result.arena_value = Write(arena, binaryValue, binaryValue.Length);
+                    break;
+                default:
+                    throw new NotSupportedException($"Values of type {value.GetType().Name} are not supported.");
+            }
+
+            return result;
+        }
+
+        private static ArenaValue Write(MemoryStream arena, byte[] bytes, int size)
+        {
+            var result = new ArenaValue
+            {
+                offset = (IntPtr)arena.Length,
+                size = (IntPtr)size
+            };
+
+            arena.Write(bytes, 0, bytes.Length);
+            return result;
+        }
+
+        /// <summary>
+        /// Reads the value back as the .NET type <see cref="Create(IList{object}, out byte[])"/> takes for it,
+        /// with strings and binaries copied out of arena. Values without a value are null and lists are
+        /// <see cref="ListPlaceholder"/>.
+        /// </summary>
+        public object Get(byte[] arena)
+        {
+            if (type.IsArray())
+            {
+                return ListPlaceholder;
+            }
+
+            if (!has_value)
+            {
+                return null;
+            }
+
+            switch (type.UnderlyingType())
+            {
+                case PropertyType.Bool:
+                    return bool_value;
+                case PropertyType.Int:
+                    return int_value;
+                case PropertyType.Float:
+                    return float_value;
+                case PropertyType.Double:
+                    return double_value;
+                case PropertyType.Date:
+                    return new DateTimeOffset(int_value, TimeSpan.Zero);
+                case PropertyType.Object:
+                    return new ObjectKey(int_value);
+                case PropertyType.String:
+                    return Encoding.Unicode.GetString(arena, (int)arena_value.offset, (int)arena_value.size * sizeof(char));
+                case PropertyType.Data:
+                    var bytes = new byte[(int)arena_value.size];
+                    Array.Copy(arena, (int)arena_value.offset, bytes, 0, bytes.Length);
+                    return bytes;
+                default:
+                    throw new NotSupportedException($"PropertyType {type} is not supported.");
+            }
+        }
+    }
+}
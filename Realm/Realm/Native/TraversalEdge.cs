@@ -0,0 +1,42 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Runtime.InteropServices;
+
+namespace Realms.Native
+{
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct TraversalEdge
+    {
+        // the TableRef* of a TableHandle, which must be kept alive for the duration of the traversal
+        public IntPtr table;
+
+        public IntPtr property_ndx;
+
+        [MarshalAs(UnmanagedType.U1)]
+        public bool backlink;
+
+        public TraversalEdge(TableHandle table, IntPtr propertyIndex, bool backlink)
+        {
+            this.table = table.DangerousGetHandle();
+            property_ndx = propertyIndex;
+            this.backlink = backlink;
+        }
+    }
+}
@@ -48,6 +48,9 @@ namespace Realms
     [DebuggerDisplay("Count = {Count}")]
     public class RealmList<T> : RealmCollectionBase<T>, IList<T>, IDynamicMetaObjectProvider
     {
+        // Primitives are written through the typed ListHandle overloads rather than as a PrimitiveValue.
+        private static readonly Lazy<PrimitiveSetters> _primitiveSetters = new Lazy<PrimitiveSetters>(PrimitiveSetters.ForArgumentType);
+
         private readonly Realm _realm;
         private readonly ListHandle _listHandle;
 
@@ -86,7 +89,7 @@ internal override CollectionHandleBase CreateHandle()
                     AddObjectToRealmIfNeeded(obj);
                     _listHandle.Set(index, obj.ObjectHandle);
                 },
-                v => _listHandle.Set(index, v),
+                v => _primitiveSetters.Value.Set(_listHandle, index, v),
                 v => _listHandle.Set(index, v),
                 v => _listHandle.Set(index, v));
             }
@@ -103,7 +106,7 @@ public void Add(T item)
                 AddObjectToRealmIfNeeded(obj);
                 _listHandle.Add(obj.ObjectHandle);
             },
-            _listHandle.Add,
+            v => _primitiveSetters.Value.Add(_listHandle, v),
             _listHandle.Add,
             _listHandle.Add);
         }
@@ -178,7 +181,7 @@ public void Insert(int index, T item)
                 AddObjectToRealmIfNeeded(obj);
                 _listHandle.Insert(index, obj.ObjectHandle);
             },
-            value => _listHandle.Insert(index, value),
+            value => _primitiveSetters.Value.Insert(_listHandle, index, value),
             value => _listHandle.Insert(index, value),
             value => _listHandle.Insert(index, value));
         }
@@ -250,7 +253,7 @@ public override IRealmCollection<T> Freeze()
 
         private static void Execute(T item,
             Action<RealmObject> objectHandler,
-            Action<PrimitiveValue> primitiveHandler,
+            Action<T> primitiveHandler,
             Action<string> stringHandler,
             Action<byte[]> binaryHandler)
         {
@@ -268,9 +271,57 @@ public override IRealmCollection<T> Freeze()
                     binaryHandler(Operator.Convert<T, byte[]>(item));
                     break;
                 default:
-                    primitiveHandler(PrimitiveValue.Create(item, _argumentType));
+                    primitiveHandler(item);
                     break;
             }
         }
+
+        private class PrimitiveSetters
+        {
+            public Action<ListHandle, T> Add { get; private set; }
+
+            public Action<ListHandle, int, T> Set { get; private set; }
+
+            public Action<ListHandle, int, T> Insert { get; private set; }
+
+            public static PrimitiveSetters ForArgumentType()
+            {
+                switch (_argumentType)
+                {
+                    case PropertyType.Bool:
+                        return Create<bool>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Bool | PropertyType.Nullable:
+                        return Create<bool?>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Int:
+                        return Create<long>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Int | PropertyType.Nullable:
+                        return Create<long?>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Float:
+                        return Create<float>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Float | PropertyType.Nullable:
+                        return Create<float?>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Double:
+                        return Create<double>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Double | PropertyType.Nullable:
+                        return Create<double?>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Date:
+                        return Create<DateTimeOffset>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    case PropertyType.Date | PropertyType.Nullable:
+                        return Create<DateTimeOffset?>((h, v) => h.Add(v), (h, i, v) => h.Set(i, v), (h, i, v) => h.Insert(i, v));
+                    default:
+                        throw new NotSupportedException($"PrimitiveType {_argumentType} is not supported.");
+                }
+            }
+
+            private static PrimitiveSetters Create<TValue>(Action<ListHandle, TValue> add, Action<ListHandle, int, TValue> set, Action<ListHandle, int, TValue> insert)
+            {
+                return new PrimitiveSetters
+                {
+                    Add = (handle, item) => add(handle, Operator.Convert<T, TValue>(item)),
+                    Set = (handle, index, item) => set(handle, index, Operator.Convert<T, TValue>(item)),
+                    Insert = (handle, index, item) => insert(handle, index, Operator.Convert<T, TValue>(item)),
+                };
+            }
+        }
     }
 }
\ No newline at end of file
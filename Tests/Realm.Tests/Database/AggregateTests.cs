@@ -0,0 +1,274 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Linq;
+using NUnit.Framework;
+using Realms.Exceptions;
+using Realms.Native;
+using Realms.Schema;
+
+namespace Realms.Tests.Database
+{
+    [TestFixture, Preserve(AllMembers = true)]
+    public class AggregateTests : RealmInstanceTest
+    {
+        private static readonly DateTimeOffset _day = new DateTimeOffset(2020, 6, 1, 0, 0, 0, TimeSpan.Zero);
+
+        protected override void CustomSetUp()
+        {
+            base.CustomSetUp();
+
+            _realm.Write(() =>
+            {
+                _realm.Add(new AllTypesObject
+                {
+                    Int32Property = 1,
+                    DoubleProperty = 1.5,
+                    NullableInt32Property = 1,
+                    StringProperty = "a",
+                    DateTimeOffsetProperty = _day.AddHours(1),
+                    RequiredStringProperty = string.Empty
+                });
+                _realm.Add(new AllTypesObject
+                {
+                    Int32Property = 2,
+                    DoubleProperty = 4.5,
+                    StringProperty = "b",
+                    DateTimeOffsetProperty = _day.AddHours(2),
+                    RequiredStringProperty = string.Empty
+                });
+                _realm.Add(new AllTypesObject
+                {
+                    Int32Property = 3,
+                    DoubleProperty = -2,
+                    NullableInt32Property = 5,
+                    StringProperty = "a",
+                    DateTimeOffsetProperty = _day.AddDays(1),
+                    RequiredStringProperty = string.Empty
+                });
+                _realm.Add(new AllTypesObject
+                {
+                    Int32Property = 4,
+                    DoubleProperty = 0,
+                    StringProperty = null,
+                    DateTimeOffsetProperty = _day.AddDays(1).AddHours(5),
+                    RequiredStringProperty = string.Empty
+                });
+            });
+        }
+
+        [Test]
+        public void Linq_Sum_ReturnsSumOfProperty()
+        {
+            var objects = _realm.All<AllTypesObject>();
+
+            Assert.That(objects.Sum(o => o.Int32Property), Is.EqualTo(10));
+            Assert.That(objects.Sum(o => o.DoubleProperty), Is.EqualTo(4.0));
+            Assert.That(objects.Sum(o => o.NullableInt32Property), Is.EqualTo(6));
+            Assert.That(objects.Where(o => o.StringProperty == "a").Sum(o => o.Int32Property), Is.EqualTo(4));
+        }
+
+        [Test]
+        public void Linq_MinMax_ReturnPropertyType()
+        {
+            var objects = _realm.All<AllTypesObject>();
+
+            Assert.That(objects.Min(o => o.Int32Property), Is.EqualTo(1));
+            Assert.That(objects.Max(o => o.Int32Property), Is.EqualTo(4));
+            Assert.That(objects.Min(o => o.DoubleProperty), Is.EqualTo(-2.0));
+            Assert.That(objects.Max(o => o.NullableInt32Property), Is.EqualTo(5));
+            Assert.That(objects.Max(o => o.DateTimeOffsetProperty), Is.EqualTo(_day.AddDays(1).AddHours(5)));
+        }
+
+        [Test]
+        public void Linq_Average_SkipsNulls()
+        {
+            var objects = _realm.All<AllTypesObject>();
+
+            Assert.That(objects.Average(o => o.Int32Property), Is.EqualTo(2.5));
+            Assert.That(objects.Average(o => o.NullableInt32Property), Is.EqualTo(3.0));
+        }
+
+        [Test]
+        public void Linq_AggregatesOfNoObjects_BehaveLikeEnumerable()
+        {
+            var objects = _realm.All<AllTypesObject>().Where(o => o.Int32Property > 100);
+
+            Assert.That(objects.Sum(o => o.Int32Property), Is.EqualTo(0));
+            Assert.That(objects.Sum(o => o.NullableInt32Property), Is.EqualTo(0));
+            Assert.That(objects.Max(o => o.NullableInt32Property), Is.Null);
+            Assert.That(objects.Average(o => o.NullableInt32Property), Is.Null);
+            Assert.That(() => objects.Min(o => o.Int32Property), Throws.TypeOf<InvalidOperationException>());
+            Assert.That(() => objects.Average(o => o.Int32Property), Throws.TypeOf<InvalidOperationException>());
+        }
+
+        [Test]
+        public void Linq_AggregateOfComputedValue_IsNotSupported()
+        {
+            var objects = _realm.All<AllTypesObject>();
+
+            Assert.That(() => objects.Sum(o => o.Int32Property * 2), Throws.TypeOf<NotSupportedException>());
+        }
+
+        [Test]
+        public void Linq_AggregateOfConvertedProperty_OnlyAllowsConversionsThatKeepTheResult()
+        {
+            var objects = _realm.All<AllTypesObject>();
+
+            Assert.That(objects.Max(o => (long)o.Int32Property), Is.EqualTo(4L));
+            Assert.That(objects.Min(o => (double?)o.Int32Property), Is.EqualTo(1.0));
+            Assert.That(objects.Sum(o => (int?)o.Int32Property), Is.EqualTo(10));
+
+            // narrowing could round or overflow each value, and widening could change what Sum and Average overflow on
+            Assert.That(() => objects.Sum(o => (int)o.DoubleProperty), Throws.TypeOf<NotSupportedException>());
+            Assert.That(() => objects.Max(o => (int)o.Int64Property), Throws.TypeOf<NotSupportedException>());
+            Assert.That(() => objects.Sum(o => (long)o.Int32Property), Throws.TypeOf<NotSupportedException>());
+            Assert.That(() => objects.Min(o => (int)o.NullableInt32Property), Throws.TypeOf<NotSupportedException>());
+        }
+
+        [Test]
+        public void ResultsAggregate_ReturnsTypedValues()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            var sum = handle.Aggregate(GetPropertyIndex(nameof(AllTypesObject.Int32Property)), AggregateType.Sum);
+            Assert.That(sum.Get<long>(), Is.EqualTo(10));
+
+            var max = handle.Aggregate(GetPropertyIndex(nameof(AllTypesObject.DoubleProperty)), AggregateType.Max);
+            Assert.That(max.type, Is.EqualTo(PropertyType.Double | PropertyType.Nullable));
+            Assert.That(max.Get<double?>(), Is.EqualTo(4.5));
+
+            var min = handle.Aggregate(GetPropertyIndex(nameof(AllTypesObject.DateTimeOffsetProperty)), AggregateType.Min);
+            Assert.That(min.Get<DateTimeOffset?>(), Is.EqualTo(_day.AddHours(1)));
+        }
+
+        [Test]
+        public void ResultsAggregate_WhenPropertyIsNotNumeric_Throws()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            Assert.That(() => handle.Aggregate(GetPropertyIndex(nameof(AllTypesObject.StringProperty)), AggregateType.Sum), Throws.InstanceOf<RealmException>());
+        }
+
+        [Test]
+        public void ListAggregate_AggregatesPrimitives()
+        {
+            var obj = new ListsObject();
+            _realm.Write(() =>
+            {
+                _realm.Add(obj);
+                obj.Int32List.Add(3);
+                obj.Int32List.Add(7);
+                obj.Int32List.Add(-1);
+            });
+
+            var handle = (ListHandle)((RealmList<int>)obj.Int32List).Handle.Value;
+
+            Assert.That(handle.Aggregate(IntPtr.Zero, AggregateType.Sum).Get<long>(), Is.EqualTo(9));
+            Assert.That(handle.Aggregate(IntPtr.Zero, AggregateType.Min).Get<long>(), Is.EqualTo(-1));
+            Assert.That(handle.Aggregate(IntPtr.Zero, AggregateType.Average).Get<double>(), Is.EqualTo(3.0));
+        }
+
+        [Test]
+        public void ParallelAggregate_OnFrozenResults_ComputesSummary()
+        {
+            var handle = GetHandle(Freeze(_realm.All<AllTypesObject>()));
+
+            var summary = handle.ParallelAggregate(GetPropertyIndex(nameof(AllTypesObject.Int32Property)), 2);
+
+            Assert.That((int)summary.count, Is.EqualTo(4));
+            Assert.That(summary.sum.Get<long>(), Is.EqualTo(10));
+            Assert.That(summary.min.Get<long>(), Is.EqualTo(1));
+            Assert.That(summary.max.Get<long>(), Is.EqualTo(4));
+            Assert.That(summary.average.Get<double>(), Is.EqualTo(2.5));
+        }
+
+        [Test]
+        public void ParallelAggregate_OnLiveResults_Throws()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            Assert.That(() => handle.ParallelAggregate(GetPropertyIndex(nameof(AllTypesObject.Int32Property))), Throws.InstanceOf<RealmException>());
+        }
+
+        [Test]
+        public void GroupBy_StringKey_GroupsInOrderFound()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+            var aggregates = new[]
+            {
+                new GroupAggregateSpec { property_ndx = GetPropertyIndex(nameof(AllTypesObject.Int32Property)), type = AggregateType.Sum },
+                new GroupAggregateSpec { property_ndx = GetPropertyIndex(nameof(AllTypesObject.DoubleProperty)), type = AggregateType.Max },
+            };
+
+            using (var groups = handle.GroupBy(GetPropertyIndex(nameof(AllTypesObject.StringProperty)), TimeSpan.Zero, aggregates))
+            {
+                Assert.That(groups.KeyType, Is.EqualTo(PropertyType.String | PropertyType.Nullable));
+                Assert.That(groups.GroupCount, Is.EqualTo(3));
+                Assert.That(groups.GetKeys(), Is.EqualTo(new object[] { "a", "b", null }));
+                Assert.That(groups.GetCounts(), Is.EqualTo(new[] { 2, 1, 1 }));
+                Assert.That(groups.GetValues(0).Select(v => v.Get<long>()), Is.EqualTo(new long[] { 4, 2, 4 }));
+                Assert.That(groups.GetValues(1).Select(v => v.Get<double>()), Is.EqualTo(new[] { 1.5, 4.5, 0 }));
+            }
+        }
+
+        [Test]
+        public void GroupBy_DateKey_GroupsByBucket()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+            var aggregates = new[]
+            {
+                new GroupAggregateSpec { property_ndx = GetPropertyIndex(nameof(AllTypesObject.NullableInt32Property)), type = AggregateType.Average },
+            };
+
+            using (var groups = handle.GroupBy(GetPropertyIndex(nameof(AllTypesObject.DateTimeOffsetProperty)), TimeSpan.FromDays(1), aggregates))
+            {
+                Assert.That(groups.KeyType, Is.EqualTo(PropertyType.Date));
+                Assert.That(groups.GetKeys(), Is.EqualTo(new object[] { _day, _day.AddDays(1) }));
+                Assert.That(groups.GetCounts(), Is.EqualTo(new[] { 2, 2 }));
+                Assert.That(groups.GetValues(0).Select(v => v.Get<double?>()), Is.EqualTo(new double?[] { 1, 5 }));
+            }
+        }
+
+        [Test]
+        public void GroupBy_IntKey_ReturnsLongKeys()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            using (var groups = handle.GroupBy(GetPropertyIndex(nameof(AllTypesObject.NullableInt32Property)), TimeSpan.Zero, new GroupAggregateSpec[0]))
+            {
+                Assert.That(groups.KeyType, Is.EqualTo(PropertyType.Int | PropertyType.Nullable));
+                Assert.That(groups.GetKeys(), Is.EqualTo(new object[] { 1L, null, 5L }));
+                Assert.That(groups.GetCounts(), Is.EqualTo(new[] { 1, 2, 1 }));
+            }
+        }
+
+        [Test]
+        public void GroupBy_WhenKeyCantBeGrouped_Throws()
+        {
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            Assert.That(() => handle.GroupBy(GetPropertyIndex(nameof(AllTypesObject.DoubleProperty)), TimeSpan.Zero, new GroupAggregateSpec[0]), Throws.InstanceOf<RealmException>());
+        }
+
+        private static ResultsHandle GetHandle<T>(IQueryable<T> query) => (ResultsHandle)((RealmResults<T>)query).Handle.Value;
+
+        private IntPtr GetPropertyIndex(string name) => _realm.Metadata[nameof(AllTypesObject)].PropertyIndices[name];
+    }
+}
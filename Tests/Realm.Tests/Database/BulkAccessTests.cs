@@ -0,0 +1,690 @@
+﻿////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+using System;
+using System.Linq;
+using System.Text;
+using NUnit.Framework;
+using Realms.Exceptions;
+using Realms.Native;
+using Realms.Schema;
+
+namespace Realms.Tests.Database
+{
+    [TestFixture, Preserve(AllMembers = true)]
+    public class BulkAccessTests : RealmInstanceTest
+    {
+        [Test]
+        public void List_Utf8Strings_RoundTrip()
+        {
+            var obj = AddListsObject();
+            var handle = GetHandle(obj.StringList);
+
+            _realm.Write(() =>
+            {
+                handle.AddUtf8(Encoding.UTF8.GetBytes("héllo"));
+                handle.AddUtf8(null);
+                handle.AddUtf8(Encoding.UTF8.GetBytes(string.Empty));
+                handle.InsertUtf8(0, Encoding.UTF8.GetBytes("first"));
+                handle.AddUtf8(Encoding.UTF8.GetBytes("last"));
+                handle.SetUtf8(4, Encoding.UTF8.GetBytes("läst"));
+            });
+
+            Assert.That(obj.StringList, Is.EqualTo(new[] { "first", "héllo", null, string.Empty, "läst" }));
+            Assert.That(handle.FindUtf8(Encoding.UTF8.GetBytes("héllo")), Is.EqualTo(1));
+            Assert.That(handle.FindUtf8(Encoding.UTF8.GetBytes("hello")), Is.EqualTo(-1));
+        }
+
+        [Test]
+        public void Object_SetUtf8_SetsString()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var stringProperty = GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.StringProperty));
+
+            _realm.Write(() => obj.ObjectHandle.SetUtf8(stringProperty, Encoding.UTF8.GetBytes("naïve")));
+            Assert.That(obj.StringProperty, Is.EqualTo("naïve"));
+
+            _realm.Write(() => obj.ObjectHandle.SetUtf8(stringProperty, null));
+            Assert.That(obj.StringProperty, Is.Null);
+        }
+
+        [Test]
+        public void Utf8EmptyStrings_AreNotNull()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var stringProperty = GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.StringProperty));
+            var list = AddListsObject();
+            var handle = GetHandle(list.StringList);
+
+            _realm.Write(() =>
+            {
+                obj.ObjectHandle.SetUtf8(stringProperty, new byte[0]);
+                handle.AddUtf8(null);
+                handle.AddUtf8(new byte[0]);
+            });
+
+            Assert.That(obj.StringProperty, Is.EqualTo(string.Empty));
+            Assert.That(list.StringList, Is.EqualTo(new[] { null, string.Empty }));
+            Assert.That(handle.FindUtf8(new byte[0]), Is.EqualTo(1));
+
+            using (var results = GetHandle(_realm.All<AllTypesObject>()))
+            using (var query = results.GetQuery())
+            {
+                query.StringEqualUtf8(query.GetColumnKey(nameof(AllTypesObject.StringProperty)), new byte[0], true);
+                Assert.That(query.Count(), Is.EqualTo(1));
+            }
+        }
+
+        [Test]
+        public void Query_Utf8StringConditions_MatchLikeUtf16Ones()
+        {
+            _realm.Write(() =>
+            {
+                _realm.Add(new Dog { Name = "Rüdiger" });
+                _realm.Add(new Dog { Name = "Rex" });
+            });
+
+            using (var results = GetHandle(_realm.All<Dog>()))
+            using (var query = results.GetQuery())
+            {
+                query.StringStartsWithUtf8(query.GetColumnKey(nameof(Dog.Name)), Encoding.UTF8.GetBytes("Rü"), true);
+                Assert.That(query.Count(), Is.EqualTo(1));
+            }
+
+            using (var results = GetHandle(_realm.All<Dog>()))
+            using (var query = results.GetQuery())
+            {
+                query.StringNotEqualUtf8(query.GetColumnKey(nameof(Dog.Name)), Encoding.UTF8.GetBytes("Rex"), true);
+                Assert.That(query.Count(), Is.EqualTo(1));
+            }
+        }
+
+        [Test]
+        public void Utf8PrimaryKeys_CreateAndFind()
+        {
+            var table = _realm.Metadata[nameof(PrimaryKeyStringObject)].Table;
+            var key = Encoding.UTF8.GetBytes("clé");
+
+            _realm.Write(() =>
+            {
+                using (var created = _realm.SharedRealmHandle.CreateObjectWithPrimaryKeyUtf8(table, key, false, out var isNew))
+                {
+                    Assert.That(isNew, Is.True);
+                }
+
+                using (var updated = _realm.SharedRealmHandle.CreateObjectWithPrimaryKeyUtf8(table, key, true, out var isNew))
+                {
+                    Assert.That(isNew, Is.False);
+                }
+            });
+
+            Assert.That(_realm.Find<PrimaryKeyStringObject>("clé"), Is.Not.Null);
+            Assert.That(table.TryFindUtf8(_realm.SharedRealmHandle, key, out var found), Is.True);
+            found.Dispose();
+            Assert.That(table.TryFindUtf8(_realm.SharedRealmHandle, Encoding.UTF8.GetBytes("cle"), out _), Is.False);
+        }
+
+        [Test]
+        public void List_Views_ReadStringsAndBinaries()
+        {
+            var obj = AddListsObject();
+            _realm.Write(() =>
+            {
+                obj.StringList.Add("héllo");
+                obj.StringList.Add(null);
+                obj.StringList.Add(string.Empty);
+                obj.ByteArrayList.Add(new byte[] { 1, 2, 3 });
+                obj.ByteArrayList.Add(null);
+            });
+
+            var strings = GetHandle(obj.StringList);
+            Assert.That(strings.GetStringViewAtIndex(0), Is.EqualTo("héllo"));
+            Assert.That(strings.GetStringViewAtIndex(1), Is.Null);
+            Assert.That(strings.GetStringViewAtIndex(2), Is.EqualTo(string.Empty));
+
+            var binaries = GetHandle(obj.ByteArrayList);
+            Assert.That(binaries.GetByteArrayViewAtIndex(0), Is.EqualTo(new byte[] { 1, 2, 3 }));
+            Assert.That(binaries.GetByteArrayViewAtIndex(1), Is.Null);
+        }
+
+        [Test]
+        public void Object_Views_ReadStringsAndBinaries()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            _realm.Write(() => obj.ByteArrayProperty = new byte[] { 4, 5 });
+
+            Assert.That(obj.ObjectHandle.GetStringView(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.StringProperty))), Is.EqualTo("s0"));
+            Assert.That(obj.ObjectHandle.GetByteArrayView(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.ByteArrayProperty))), Is.EqualTo(new byte[] { 4, 5 }));
+            Assert.That(obj.ObjectHandle.GetStringView(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.RequiredStringProperty))), Is.EqualTo(string.Empty));
+
+            _realm.Write(() => obj.ByteArrayProperty = new byte[0]);
+            Assert.That(obj.ObjectHandle.GetByteArrayView(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.ByteArrayProperty))), Is.EqualTo(new byte[0]));
+        }
+
+        [Test]
+        public void Results_GetColumnValues_ReadsProperty()
+        {
+            AddAllTypesObjects(3);
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            Assert.That(handle.GetColumnValues<int>(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.Int32Property)), PropertyType.Int, 0, 3),
+                Is.EqualTo(new[] { 0, 1, 2 }));
+            Assert.That(handle.GetColumnValues<int?>(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.NullableInt32Property)), PropertyType.Int | PropertyType.Nullable, 1, 5),
+                Is.EqualTo(new int?[] { null, 2 }));
+        }
+
+        [Test]
+        public void Results_GetStringColumnValues_ReadsProperty()
+        {
+            AddAllTypesObjects(3);
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            Assert.That(handle.GetStringColumnValues(GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.StringProperty)), 0, 3),
+                Is.EqualTo(new[] { "s0", null, "s2" }));
+        }
+
+        [Test]
+        public void List_GetStrings_WhenLongerThanBuffer_ReadsAll()
+        {
+            var obj = AddListsObject();
+            var expected = Enumerable.Range(0, 50).Select(i => i % 7 == 3 ? null : new string('x', i * 10)).ToArray();
+            _realm.Write(() =>
+            {
+                foreach (var value in expected)
+                {
+                    obj.StringList.Add(value);
+                }
+            });
+
+            var handle = GetHandle(obj.StringList);
+            Assert.That(handle.GetStrings(0, expected.Length), Is.EqualTo(expected));
+            Assert.That(handle.GetStrings(45, 10), Is.EqualTo(expected.Skip(45)));
+        }
+
+        [Test]
+        public void List_GetPrimitives_ReadsRange()
+        {
+            var obj = AddListsObject();
+            _realm.Write(() =>
+            {
+                obj.Int64List.Add(1);
+                obj.Int64List.Add(-2);
+                obj.Int64List.Add(long.MaxValue);
+                obj.NullableDoubleList.Add(1.5);
+                obj.NullableDoubleList.Add(null);
+            });
+
+            var handle = GetHandle(obj.Int64List);
+            Assert.That(handle.GetPrimitives<long>(PropertyType.Int, 0, 3), Is.EqualTo(new long[] { 1, -2, long.MaxValue }));
+            Assert.That(handle.GetPrimitives<long>(PropertyType.Int, 1, 10), Is.EqualTo(new long[] { -2, long.MaxValue }));
+            Assert.That(GetHandle(obj.NullableDoubleList).GetPrimitives<double?>(PropertyType.Double | PropertyType.Nullable, 0, 2), Is.EqualTo(new double?[] { 1.5, null }));
+        }
+
+        [Test]
+        public void List_AddPrimitives_AddsAll()
+        {
+            var obj = AddListsObject();
+            var handle = GetHandle(obj.Int64List);
+
+            _realm.Write(() => handle.AddPrimitives(new long[] { 1, -2, long.MaxValue }, PropertyType.Int));
+
+            Assert.That(obj.Int64List, Is.EqualTo(new long[] { 1, -2, long.MaxValue }));
+        }
+
+        [Test]
+        public void List_SetPrimitives_KeepsNulls()
+        {
+            var obj = AddListsObject();
+            var handle = GetHandle(obj.NullableDoubleList);
+
+            _realm.Write(() =>
+            {
+                handle.AddPrimitives(new double?[] { 1.5, null, -3 }, PropertyType.Double | PropertyType.Nullable);
+                handle.SetPrimitives(1, new double?[] { 2.5, null }, PropertyType.Double | PropertyType.Nullable);
+            });
+
+            Assert.That(obj.NullableDoubleList, Is.EqualTo(new double?[] { 1.5, 2.5, null }));
+        }
+
+        [Test]
+        public void List_InsertPrimitives_InsertsInOrder()
+        {
+            var obj = AddListsObject();
+            var handle = GetHandle(obj.BooleanList);
+
+            _realm.Write(() =>
+            {
+                obj.BooleanList.Add(true);
+                handle.InsertPrimitives(0, new[] { false, false }, PropertyType.Bool);
+            });
+
+            Assert.That(obj.BooleanList, Is.EqualTo(new[] { false, false, true }));
+        }
+
+        [Test]
+        public void List_TypedPrimitives_RoundTrip()
+        {
+            var obj = AddListsObject();
+            var date = new DateTimeOffset(2020, 1, 2, 3, 4, 5, TimeSpan.Zero);
+
+            _realm.Write(() =>
+            {
+                GetHandle(obj.Int64List).Add(5L);
+                GetHandle(obj.Int64List).Insert(0, 4L);
+                GetHandle(obj.Int64List).Set(1, 6L);
+                GetHandle(obj.NullableDoubleList).Add((double?)null);
+                GetHandle(obj.NullableDoubleList).Add((double?)2.5);
+                GetHandle(obj.DateTimeOffsetList).Add(date);
+            });
+
+            Assert.That(obj.Int64List, Is.EqualTo(new long[] { 4, 6 }));
+            Assert.That(obj.NullableDoubleList, Is.EqualTo(new double?[] { null, 2.5 }));
+            Assert.That(obj.DateTimeOffsetList, Is.EqualTo(new[] { date }));
+        }
+
+        [Test]
+        public void Getters_OnDeletedObject_ThrowInvalidObject()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var handle = obj.ObjectHandle;
+            var stringProperty = GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.StringProperty));
+
+            _realm.Write(() => _realm.Remove(obj));
+
+            Assert.That(() => handle.GetStringView(stringProperty), Throws.TypeOf<RealmInvalidObjectException>());
+
+            // the message of the preallocated error is reported like any other
+            Assert.That(() => handle.GetStringView(stringProperty), Throws.TypeOf<RealmInvalidObjectException>().With.Message.Not.Empty);
+        }
+
+        [Test]
+        public void Object_GetAllProperties_ReadsEveryProperty()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            _realm.Write(() =>
+            {
+                obj.DoubleProperty = 2.5;
+                obj.BooleanProperty = true;
+                obj.ByteArrayProperty = new byte[] { 4, 5 };
+                obj.DateTimeOffsetProperty = new DateTimeOffset(2020, 1, 2, 3, 4, 5, TimeSpan.Zero);
+            });
+
+            var metadata = _realm.Metadata[nameof(AllTypesObject)];
+            var values = obj.ObjectHandle.GetAllProperties(metadata.Schema.Count);
+
+            object Value(string name) => values[(int)metadata.PropertyIndices[name]];
+
+            Assert.That(Value(nameof(AllTypesObject.Int32Property)), Is.EqualTo(0L));
+            Assert.That(Value(nameof(AllTypesObject.DoubleProperty)), Is.EqualTo(2.5));
+            Assert.That(Value(nameof(AllTypesObject.BooleanProperty)), Is.EqualTo(true));
+            Assert.That(Value(nameof(AllTypesObject.StringProperty)), Is.EqualTo("s0"));
+            Assert.That(Value(nameof(AllTypesObject.RequiredStringProperty)), Is.EqualTo(string.Empty));
+            Assert.That(Value(nameof(AllTypesObject.ByteArrayProperty)), Is.EqualTo(new byte[] { 4, 5 }));
+            Assert.That(Value(nameof(AllTypesObject.DateTimeOffsetProperty)), Is.EqualTo(new DateTimeOffset(2020, 1, 2, 3, 4, 5, TimeSpan.Zero)));
+            Assert.That(Value(nameof(AllTypesObject.NullableDoubleProperty)), Is.Null);
+        }
+
+        [Test]
+        public void Object_GetAllProperties_MarksLists()
+        {
+            var obj = AddListsObject();
+            var values = obj.ObjectHandle.GetAllProperties(_realm.Metadata[nameof(ListsObject)].Schema.Count);
+
+            Assert.That(values.Length, Is.GreaterThan(0));
+            Assert.That(values.All(v => v == PropertyValue.ListPlaceholder), Is.True);
+        }
+
+        [Test]
+        public void Object_GetAllProperties_WhenBufferIsTooSmall_Throws()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var propertyCount = _realm.Metadata[nameof(AllTypesObject)].Schema.Count;
+
+            Assert.That(() => obj.ObjectHandle.GetAllProperties(propertyCount - 1), Throws.TypeOf<ArgumentOutOfRangeException>());
+        }
+
+        [Test]
+        public void Object_GetAllProperties_OnDeletedObject_ThrowsInvalidObject()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var handle = obj.ObjectHandle;
+            var propertyCount = _realm.Metadata[nameof(AllTypesObject)].Schema.Count;
+
+            _realm.Write(() => _realm.Remove(obj));
+
+            Assert.That(() => handle.GetAllProperties(propertyCount), Throws.TypeOf<RealmInvalidObjectException>());
+        }
+
+        [Test]
+        public void Object_SetProperties_SetsEveryProperty()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var indices = new[]
+            {
+                GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.Int64Property)),
+                GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.SingleProperty)),
+                GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.StringProperty)),
+                GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.NullableInt32Property)),
+            };
+
+            _realm.Write(() => obj.ObjectHandle.SetProperties(indices, new object[] { 42L, 1.5f, "ünïcode", null }));
+
+            Assert.That(obj.Int64Property, Is.EqualTo(42));
+            Assert.That(obj.SingleProperty, Is.EqualTo(1.5f));
+            Assert.That(obj.StringProperty, Is.EqualTo("ünïcode"));
+            Assert.That(obj.NullableInt32Property, Is.Null);
+        }
+
+        [Test]
+        public void Object_SetProperties_OnlyAcceptsTheCurrentPrimaryKey()
+        {
+            var obj = new PrimaryKeyStringObject { StringProperty = "key", Value = "a" };
+            _realm.Write(() => _realm.Add(obj));
+
+            var indices = new[]
+            {
+                GetPropertyIndex<PrimaryKeyStringObject>(nameof(PrimaryKeyStringObject.StringProperty)),
+                GetPropertyIndex<PrimaryKeyStringObject>(nameof(PrimaryKeyStringObject.Value)),
+            };
+
+            _realm.Write(() => obj.ObjectHandle.SetProperties(indices, new object[] { "key", "b" }));
+            Assert.That(obj.Value, Is.EqualTo("b"));
+
+            Assert.That(() => _realm.Write(() => obj.ObjectHandle.SetProperties(indices, new object[] { "other", "c" })),
+                Throws.TypeOf<InvalidOperationException>());
+            Assert.That(obj.StringProperty, Is.EqualTo("key"));
+        }
+
+        [Test]
+        public void Object_SetProperties_WhenCountsDiffer_Throws()
+        {
+            var obj = AddAllTypesObjects(1)[0];
+            var indices = new[] { GetPropertyIndex<AllTypesObject>(nameof(AllTypesObject.Int64Property)) };
+
+            Assert.That(() => _realm.Write(() => obj.ObjectHandle.SetProperties(indices, new object[] { 1L, 2L })),
+                Throws.TypeOf<ArgumentException>());
+        }
+
+        [Test]
+        public void Results_GetKeys_MatchObjectKeys()
+        {
+            var objects = AddAllTypesObjects(3);
+            var handle = GetHandle(_realm.All<AllTypesObject>());
+
+            Assert.That(handle.GetKeys(0, 3), Is.EqualTo(objects.Select(o => o.ObjectHandle.GetKey())));
+            Assert.That(handle.GetKeys(2, 3), Is.EqualTo(new[] { objects[2].ObjectHandle.GetKey() }));
+        }
+
+        [Test]
+        public void Table_Accessors_ReadByKey()
+        {
+            var alice = new Owner { Name = "Alice", TopDog = new Dog { Name = "Rex" } };
+            _realm.Write(() => _realm.Add(alice));
+
+            var table = _realm.Metadata[nameof(Owner)].Table;
+            var key = alice.ObjectHandle.GetKey();
+
+            Assert.That(table.GetString(_realm.SharedRealmHandle, key, GetPropertyIndex<Owner>(nameof(Owner.Name))), Is.EqualTo("Alice"));
+            Assert.That(table.TryGetLinkKey(_realm.SharedRealmHandle, key, GetPropertyIndex<Owner>(nameof(Owner.TopDog)), out var dogKey), Is.True);
+            Assert.That(dogKey, Is.EqualTo(alice.TopDog.ObjectHandle.GetKey()));
+
+            var dogTable = _realm.Metadata[nameof(Dog)].Table;
+            var vaccinated = dogTable.GetPrimitive(_realm.SharedRealmHandle, dogKey, GetPropertyIndex<Dog>(nameof(Dog.Vaccinated)));
+            Assert.That(vaccinated.Get<bool>(), Is.False);
+        }
+
+        [Test]
+        public void HandleCounters_TrackLiveHandles()
+        {
+            AddAllTypesObjects(1);
+            var results = GetHandle(_realm.All<AllTypesObject>());
+
+            // let handles released by earlier tests reach the unbind list, and flush it by creating a handle
+            GC.Collect();
+            GC.WaitForPendingFinalizers();
+            Assert.That(results.TryGetObjectAtIndex(0, out var first), Is.True);
+
+            var before = RealmHandle.GetHandleCounters()[(int)HandleKind.Object];
+
+            var handles = new ObjectHandle[10];
+            for (var i = 0; i < handles.Length; i++)
+            {
+                Assert.That(results.TryGetObjectAtIndex(0, out handles[i]), Is.True);
+            }
+
+            var created = RealmHandle.GetHandleCounters()[(int)HandleKind.Object];
+            Assert.That((long)created.live, Is.EqualTo((long)before.live + handles.Length));
+            Assert.That((long)created.peak, Is.GreaterThanOrEqualTo((long)created.live));
+
+            // disposed children are queued on their root and destroyed when the next handle is created
+            foreach (var handle in handles)
+            {
+                handle.Dispose();
+            }
+
+            Assert.That(results.TryGetObjectAtIndex(0, out var last), Is.True);
+
+            var after = RealmHandle.GetHandleCounters()[(int)HandleKind.Object];
+            Assert.That((long)after.live, Is.LessThanOrEqualTo((long)before.live + 1));
+            Assert.That((long)after.peak, Is.GreaterThanOrEqualTo((long)created.live));
+
+            first.Dispose();
+            last.Dispose();
+        }
+
+        [Test]
+        public void Refresh_DestroysQueuedHandles()
+        {
+            AddAllTypesObjects(1);
+            var results = GetHandle(_realm.All<AllTypesObject>());
+
+            var handles = new ObjectHandle[10];
+            for (var i = 0; i < handles.Length; i++)
+            {
+                Assert.That(results.TryGetObjectAtIndex(0, out handles[i]), Is.True);
+            }
+
+            var created = RealmHandle.GetHandleCounters()[(int)HandleKind.Object];
+
+            foreach (var handle in handles)
+            {
+                handle.Dispose();
+            }
+
+            _realm.Refresh();
+
+            var after = RealmHandle.GetHandleCounters()[(int)HandleKind.Object];
+            Assert.That((long)after.live, Is.LessThanOrEqualTo((long)created.live - handles.Length));
+        }
+
+        [Test]
+        public void Results_KeyPathAccessors_FollowLinks()
+        {
+            var rex = new Dog { Name = "Rex" };
+            _realm.Write(() =>
+            {
+                _realm.Add(new Owner { Name = "Alice", TopDog = rex });
+                _realm.Add(new Owner { Name = "Bob" });
+            });
+
+            var handle = GetHandle(_realm.All<Owner>());
+            var topDog = GetPropertyIndex<Owner>(nameof(Owner.TopDog));
+            var vaccinated = GetPropertyIndex<Dog>(nameof(Dog.Vaccinated));
+
+            var keys = handle.GetKeyPathKeys(new[] { topDog }, 0, 2);
+            Assert.That(keys[0], Is.EqualTo(rex.ObjectHandle.GetKey()));
+            Assert.That(keys[1].IsNull);
+
+            var values = handle.GetKeyPathPrimitives(new[] { topDog, vaccinated }, 0, 2);
+            Assert.That(values.Select(v => v.has_value), Is.EqualTo(new[] { true, false }));
+        }
+
+        [Test]
+        public void Object_KeyPathAccessors_FollowLinks()
+        {
+            var alice = new Owner { Name = "Alice", TopDog = new Dog { Name = "Rex", Vaccinated = true } };
+            var bob = new Owner { Name = "Bob" };
+            _realm.Write(() =>
+            {
+                _realm.Add(alice);
+                _realm.Add(bob);
+            });
+
+            var topDogName = new[] { GetPropertyIndex<Owner>(nameof(Owner.TopDog)), GetPropertyIndex<Dog>(nameof(Dog.Name)) };
+            var topDogVaccinated = new[] { GetPropertyIndex<Owner>(nameof(Owner.TopDog)), GetPropertyIndex<Dog>(nameof(Dog.Vaccinated)) };
+
+            Assert.That(alice.ObjectHandle.GetKeyPathString(topDogName), Is.EqualTo("Rex"));
+            Assert.That(bob.ObjectHandle.GetKeyPathString(topDogName), Is.Null);
+            Assert.That(alice.ObjectHandle.GetKeyPathPrimitive(topDogVaccinated).Get<bool>(), Is.True);
+            Assert.That(bob.ObjectHandle.GetKeyPathPrimitive(topDogVaccinated).has_value, Is.False);
+
+            var topDog = new[] { GetPropertyIndex<Owner>(nameof(Owner.TopDog)) };
+            Assert.That(alice.ObjectHandle.TryGetKeyPathLink(topDog, out var dog), Is.True);
+            Assert.That(dog.GetKey(), Is.EqualTo(alice.TopDog.ObjectHandle.GetKey()));
+            Assert.That(bob.ObjectHandle.TryGetKeyPathLink(topDog, out _), Is.False);
+            dog.Dispose();
+
+            Assert.That(() => alice.ObjectHandle.GetKeyPathString(topDogVaccinated), Throws.TypeOf<InvalidOperationException>());
+            Assert.That(() => alice.ObjectHandle.TryGetKeyPathLink(topDogName, out _), Throws.InstanceOf<RealmException>());
+        }
+
+        [Test]
+        public void TraverseLinks_ReachesLinkedObjects()
+        {
+            var rex = new Dog { Name = "Rex" };
+            var fido = new Dog { Name = "Fido" };
+            var alice = new Owner { Name = "Alice", TopDog = rex };
+            _realm.Write(() =>
+            {
+                _realm.Add(alice);
+                alice.Dogs.Add(rex);
+                alice.Dogs.Add(fido);
+            });
+
+            var ownerTable = _realm.Metadata[nameof(Owner)].Table;
+            var edges = new[]
+            {
+                new TraversalEdge(ownerTable, GetPropertyIndex<Owner>(nameof(Owner.TopDog)), false),
+                new TraversalEdge(ownerTable, GetPropertyIndex<Owner>(nameof(Owner.Dogs)), false),
+            };
+
+            var start = new[] { alice.ObjectHandle.GetKey() };
+            using (var result = _realm.SharedRealmHandle.TraverseLinks(ownerTable, start, edges, 1, true))
+            {
+                Assert.That(result.TableCount, Is.EqualTo(2));
+                Assert.That(result.GetKeys(0), Is.EqualTo(start));
+                Assert.That(result.GetKeys(1), Is.EquivalentTo(new[] { rex.ObjectHandle.GetKey(), fido.ObjectHandle.GetKey() }));
+
+                using (var dogTable = result.GetTable(1))
+                {
+                    Assert.That(dogTable.GetName(), Is.EqualTo("class_Dog"));
+                }
+            }
+
+            using (var result = _realm.SharedRealmHandle.TraverseLinks(ownerTable, start, edges, 1, false))
+            {
+                Assert.That(result.GetKeyCount(1), Is.EqualTo(3), "Rex is reached both as the top dog and through the list");
+            }
+
+            using (var result = _realm.SharedRealmHandle.TraverseLinks(ownerTable, start, edges, 0, true))
+            {
+                Assert.That(result.TableCount, Is.EqualTo(1));
+            }
+        }
+
+        [Test]
+        public void Results_GetBacklinkCounts_CountsPerObject()
+        {
+            var rex = new Dog { Name = "Rex" };
+            var fido = new Dog { Name = "Fido" };
+            _realm.Write(() =>
+            {
+                _realm.Add(new Owner { Name = "Alice", TopDog = rex });
+                _realm.Add(new Owner { Name = "Bob", TopDog = rex });
+                _realm.Add(fido);
+            });
+
+            var handle = GetHandle(_realm.All<Dog>());
+            var owners = GetPropertyIndex<Dog>(nameof(Dog.Owners));
+
+            Assert.That(handle.GetBacklinkCounts(owners, 0, 2), Is.EqualTo(new[] { 0, 0 }));
+
+            _realm.Write(() =>
+            {
+                _realm.All<Owner>().First().Dogs.Add(rex);
+                _realm.All<Owner>().Last().Dogs.Add(rex);
+            });
+
+            Assert.That(handle.GetBacklinkCounts(owners, 0, 2), Is.EqualTo(new[] { 2, 0 }));
+            Assert.That(rex.ObjectHandle.GetBacklinkCount(owners), Is.EqualTo(2));
+        }
+
+        [Test]
+        public void Results_GetFilteredResults_BindsArguments()
+        {
+            _realm.Write(() =>
+            {
+                _realm.Add(new Dog { Name = "Rex", Vaccinated = true });
+                _realm.Add(new Dog { Name = "Rex", Vaccinated = false });
+                _realm.Add(new Dog { Name = "Fido", Vaccinated = true });
+            });
+
+            var handle = GetHandle(_realm.All<Dog>());
+            using (var filtered = handle.GetFilteredResults("Name == $0 AND Vaccinated == $1", new object[] { "Rex", true }))
+            {
+                Assert.That(filtered.Count(), Is.EqualTo(1));
+            }
+
+            Assert.That(() => handle.GetFilteredResults("Name == $0", new object[] { 5 }), Throws.InstanceOf<RealmException>());
+        }
+
+        private ListsObject AddListsObject()
+        {
+            var obj = new ListsObject();
+            _realm.Write(() => _realm.Add(obj));
+            return obj;
+        }
+
+        private AllTypesObject[] AddAllTypesObjects(int count)
+        {
+            var objects = Enumerable.Range(0, count).Select(i => new AllTypesObject
+            {
+                Int32Property = i,
+                NullableInt32Property = i % 2 == 0 ? i : (int?)null,
+                StringProperty = i % 2 == 0 ? $"s{i}" : null,
+                RequiredStringProperty = string.Empty
+            }).ToArray();
+
+            _realm.Write(() =>
+            {
+                foreach (var obj in objects)
+                {
+                    _realm.Add(obj);
+                }
+            });
+
+            return objects;
+        }
+
+        private static ListHandle GetHandle<T>(System.Collections.Generic.IList<T> list) => (ListHandle)((RealmList<T>)list).Handle.Value;
+
+        private static ResultsHandle GetHandle<T>(IQueryable<T> query) => (ResultsHandle)((RealmResults<T>)query).Handle.Value;
+
+        private IntPtr GetPropertyIndex<T>(string name) => _realm.Metadata[typeof(T).Name].PropertyIndices[name];
+    }
+}
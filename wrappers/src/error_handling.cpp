@@ -18,6 +18,9 @@
 #include <stdexcept>
 #include <sstream>
 #include <cassert>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include "object-store/src/shared_realm.hpp"
 #include "object-store/src/object_store.hpp"
 #include "wrapper_exceptions.hpp"
@@ -31,8 +34,77 @@
 #include "realm/alloc_slab.hpp"
 #include "object_accessor.hpp"
 
+namespace {
+
+    // Indexed by StaticErrorMessage.
+    const char* const static_error_messages[] = {
+        "Attempted to access detached row",
+        "This object belongs to a closed realm.",
+    };
+
+    // Per-thread storage for error messages, so that reporting an error doesn't allocate.
+    // Errors are consumed by the managed side right after the call that reported them returns.
+    struct ErrorRecord {
+        char message[512];
+        char detail[256];
+    };
+
+    thread_local ErrorRecord error_record;
+
+    void* copy_to_record(const std::string& value, char* record, size_t record_size)
+    {
+        value.copy(record, std::min(value.size(), record_size));
+        return record;
+    }
+
+    realm::NativeException::Marshallable record_message(realm::RealmErrorType type, size_t message_size)
+    {
+        realm::NativeException::Marshallable ex = { type, error_record.message, message_size, nullptr, 0 };
+        ex.messagesPreallocated = true;
+        return ex;
+    }
+
+}   // anonymous namespace
+
 namespace realm {
 
+    NativeException::Marshallable NativeException::for_marshalling_to_error_record() const
+    {
+        if (message.size() > sizeof(error_record.message) || detail.size() > sizeof(error_record.detail)) {
+            return for_marshalling();
+        }
+
+        Marshallable ex = {
+            type,
+            copy_to_record(message, error_record.message, sizeof(error_record.message)),
+            message.size(),
+            copy_to_record(detail, error_record.detail, sizeof(error_record.detail)),
+            detail.size(),
+        };
+        ex.messagesPreallocated = true;
+        return ex;
+    }
+
+    const char* get_static_error_message(StaticErrorMessage message)
+    {
+        return static_error_messages[static_cast<size_t>(message)];
+    }
+
+    void set_error(NativeException::Marshallable& ex, RealmErrorType type, StaticErrorMessage message)
+    {
+        const char* text = get_static_error_message(message);
+        const size_t message_size = std::min(std::strlen(text), sizeof(error_record.message));
+        std::memcpy(error_record.message, text, message_size);
+        ex = record_message(type, message_size);
+    }
+
+    void set_index_out_of_range(NativeException::Marshallable& ex, const char* context, size_t ndx, size_t count)
+    {
+        const int length = std::snprintf(error_record.message, sizeof(error_record.message), "%s index:%zu beyond range of:%zu", context, ndx, count);
+        const size_t message_size = length < 0 ? 0 : std::min(static_cast<size_t>(length), sizeof(error_record.message) - 1);
+        ex = record_message(RealmErrorType::StdIndexOutOfRange, message_size);
+    }
+
     SetDuplicatePrimaryKeyValueException::SetDuplicatePrimaryKeyValueException(std::string object_type, std::string property, std::string value)
         : std::runtime_error(util::format(
             "A %1 object already exists with primary key property %2 == '%3'",
@@ -93,9 +165,15 @@ namespace realm {
         catch (const InvalidDatabase& e) {
             return { RealmErrorType::RealmInvalidDatabase, e.what() };
         }
+        catch (const InvalidUtf8Exception& e) {
+            return { RealmErrorType::RealmInvalidDatabase, e.what() };
+        }
         catch (const IndexOutOfRangeException& e) {
             return { RealmErrorType::StdIndexOutOfRange, e.what() };
         }
+        catch (const PropertyTypeMismatchException& e) {
+            return { RealmErrorType::StdInvalidOperation, e.what() };
+        }
         catch (const RowDetachedException& e) {
             return { RealmErrorType::RealmRowDetached, e.what() };
         }
@@ -117,6 +195,9 @@ namespace realm {
         catch (const ObjectManagedByAnotherRealmException& e) {
             return { RealmErrorType::ObjectManagedByAnotherRealm, e.what() };
         }
+        catch (const ModifyPrimaryKeyException& e) {
+            return { RealmErrorType::StdInvalidOperation, e.what() };
+        }
         catch (const RealmFeatureUnavailableException& e) {
             return { RealmErrorType::RealmFeatureUnavailable, e.what() };
         }
@@ -36,6 +36,8 @@ struct NativeException {
         size_t messageLength;
         void* detailBytes;
         size_t detailLength;
+        // Set when the messages live in storage the wrappers own, so the managed side must not free them.
+        bool messagesPreallocated = false;
     };
     
     Marshallable for_marshalling() const {
@@ -53,16 +55,36 @@ struct NativeException {
             detail.size(),
         };
     }
+    
+    // Same as for_marshalling, but copies into the calling thread's error record when the
+    // strings fit, so only use it when the error is consumed before the thread reports another one.
+    Marshallable for_marshalling_to_error_record() const;
+};
+
+// Fixed messages for errors that hot paths report without throwing. The matching exceptions
+// below use the same text.
+enum class StaticErrorMessage {
+    RowDetached,
+    RealmClosed,
 };
+
+const char* get_static_error_message(StaticErrorMessage message);
+
+// Reports an error through ex without throwing or allocating. The message lives in the calling
+// thread's error record until the next error is reported on that thread.
+void set_error(NativeException::Marshallable& ex, RealmErrorType type, StaticErrorMessage message);
+
+// Reports an index out of range error through ex without throwing or allocating, like set_error.
+void set_index_out_of_range(NativeException::Marshallable& ex, const char* context, size_t ndx, size_t count);
     
 class RowDetachedException : public std::runtime_error {
 public:
-    RowDetachedException() : std::runtime_error("Attempted to access detached row") {}
+    RowDetachedException() : std::runtime_error(get_static_error_message(StaticErrorMessage::RowDetached)) {}
 };
     
 class RealmClosedException : public std::runtime_error {
 public:
-    RealmClosedException() : std::runtime_error("This object belongs to a closed realm.") {}
+    RealmClosedException() : std::runtime_error(get_static_error_message(StaticErrorMessage::RealmClosed)) {}
 };
 
 class SetDuplicatePrimaryKeyValueException : public std::runtime_error {
@@ -80,6 +102,16 @@ public:
     RealmFeatureUnavailableException(std::string message) : std::runtime_error(message) {}
 };
 
+class ModifyPrimaryKeyException : public std::runtime_error {
+public:
+    ModifyPrimaryKeyException() : std::runtime_error("Once set, primary key properties may not be modified.") {}
+};
+
+class InvalidUtf8Exception : public std::runtime_error {
+public:
+    InvalidUtf8Exception() : std::runtime_error("Corrupted string data") {}
+};
+
 
 REALM_EXPORT NativeException convert_exception();
 
@@ -105,7 +137,7 @@ auto handle_errors(NativeException::Marshallable& ex, F&& func) -> decltype(func
         return func();
     }
     catch (...) {
-        ex = convert_exception().for_marshalling();  
+        ex = convert_exception().for_marshalling_to_error_record();
         return Default<RetVal>::default_value();
     }
 }
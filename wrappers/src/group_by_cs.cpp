@@ -0,0 +1,360 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include <object_accessor.hpp>
+#include <results.hpp>
+
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "timestamp_helpers.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+using namespace realm;
+using namespace realm::binding;
+
+// An aggregate to compute for every group, over the property at property_ndx.
+struct GroupAggregateSpec
+{
+    size_t property_ndx;
+    AggregateType type;
+};
+
+// The groups found by results_group_by, in the order they were first encountered. String keys are
+// kept in string_keys and all others in int_keys - ints as is, links as object keys and dates as
+// the ticks of the start of their bucket.
+struct GroupByResult
+{
+    realm::PropertyType key_type;
+    std::vector<bool> null_keys;
+    std::vector<int64_t> int_keys;
+    std::vector<std::string> string_keys;
+    std::vector<size_t> counts;
+
+    // values[i] holds the result of the i-th aggregate for every group.
+    std::vector<std::vector<PrimitiveValue>> values;
+};
+
+namespace {
+
+struct GroupKey {
+    bool is_null;
+    int64_t int_value;
+    std::string string_value;
+
+    bool operator==(const GroupKey& other) const
+    {
+        return is_null == other.is_null && int_value == other.int_value && string_value == other.string_value;
+    }
+};
+
+struct GroupKeyHash {
+    size_t operator()(const GroupKey& key) const
+    {
+        return key.is_null ? 0 : std::hash<int64_t>()(key.int_value) ^ std::hash<std::string>()(key.string_value);
+    }
+};
+
+// Running aggregates of one property within one group, kept in the PartialAggregate of the marshaled
+// type of the property - int64_t for ints and dates (as ticks), float or double.
+using Accumulator = std::tuple<PartialAggregate<int64_t>, PartialAggregate<float>, PartialAggregate<double>>;
+
+template<typename T>
+struct Accumulate {
+    static void apply(const Obj& obj, ColKey column_key, Accumulator& accumulator)
+    {
+        using Mapping = PrimitiveMapping<T>;
+        const auto stored = obj.get<typename Mapping::StorageType>(column_key);
+        if (!Mapping::is_null(stored))
+            std::get<PartialAggregate<typename Mapping::MarshaledType>>(accumulator).add(Mapping::to_marshaled(stored));
+    }
+};
+
+// Converts the accumulated values to the result of an aggregate of the given type. Min and max have the
+// type of the property, sums are ints or doubles and averages doubles.
+template<typename T>
+struct ToPrimitive {
+    static PrimitiveValue apply(AggregateType type, realm::PropertyType base_type, const Accumulator& accumulator)
+    {
+        using Value = typename PrimitiveMapping<T>::MarshaledType;
+        using SumType = typename PartialAggregate<Value>::SumType;
+        const auto& aggregate = std::get<PartialAggregate<Value>>(accumulator);
+
+        PrimitiveValue value {};
+        value.has_value = aggregate.count > 0;
+        switch (type) {
+            case AggregateType::Min:
+            case AggregateType::Max:
+                value.type = base_type | realm::PropertyType::Nullable;
+                PrimitiveField<Value>::get(value) = type == AggregateType::Min ? aggregate.min : aggregate.max;
+                break;
+            case AggregateType::Sum:
+                // like core, the sum of no values is 0
+                value.has_value = true;
+                value.type = std::is_integral<SumType>::value ? realm::PropertyType::Int : realm::PropertyType::Double;
+                PrimitiveField<SumType>::get(value) = aggregate.sum;
+                break;
+            case AggregateType::Average:
+                value.type = realm::PropertyType::Double | realm::PropertyType::Nullable;
+                if (value.has_value)
+                    value.value.double_value = static_cast<double>(aggregate.sum) / static_cast<double>(aggregate.count);
+                break;
+        }
+
+        return value;
+    }
+};
+
+struct ResolvedSpec {
+    AggregateType type;
+    realm::PropertyType base_type;
+    ColKey column_key;
+    void (*accumulate)(const Obj&, ColKey, Accumulator&);
+    PrimitiveValue (*to_primitive)(AggregateType, realm::PropertyType, const Accumulator&);
+};
+
+ResolvedSpec resolve_spec(const ObjectSchema& object_schema, const GroupAggregateSpec& spec)
+{
+    const Property& property = object_schema.persisted_properties.at(spec.property_ndx);
+    const auto base_type = property.type & ~realm::PropertyType::Nullable;
+    const auto accumulate = PrimitiveDispatch<Accumulate, DispatchTypes::Numerics>::find(property.type);
+
+    // dates can only be compared, not summed
+    const bool is_sum = spec.type == AggregateType::Sum || spec.type == AggregateType::Average;
+    if (!accumulate || (base_type == realm::PropertyType::Date && is_sum))
+        throw std::invalid_argument(util::format("Property '%1' can't be aggregated this way.", property.name));
+
+    return { spec.type, base_type, property.column_key, accumulate, PrimitiveDispatch<ToPrimitive, DispatchTypes::Numerics>::get(property.type) };
+}
+
+void accumulate(const Obj& obj, const ResolvedSpec& spec, Accumulator& accumulator)
+{
+    spec.accumulate(obj, spec.column_key, accumulator);
+}
+
+PrimitiveValue to_primitive(const ResolvedSpec& spec, const Accumulator& accumulator)
+{
+    return spec.to_primitive(spec.type, spec.base_type, accumulator);
+}
+
+int64_t floor_to_bucket(int64_t ticks, int64_t bucket_ticks)
+{
+    int64_t bucket = ticks / bucket_ticks;
+    if (ticks % bucket_ticks != 0 && ticks < 0)
+        --bucket;
+    return bucket * bucket_ticks;
+}
+
+// Reads the group key of an object. Ints and links are keyed by their value and dates by the start
+// of their bucket of bucket_ticks, or their ticks if it is 0.
+template<typename T>
+struct ReadKey {
+    static GroupKey apply(const Obj& obj, ColKey column_key, int64_t)
+    {
+        using Mapping = PrimitiveMapping<T>;
+        const auto stored = obj.get<typename Mapping::StorageType>(column_key);
+        return { Mapping::is_null(stored), static_cast<int64_t>(Mapping::to_marshaled(stored)), {} };
+    }
+};
+
+template<>
+struct ReadKey<StringData> {
+    static GroupKey apply(const Obj& obj, ColKey column_key, int64_t)
+    {
+        const StringData value = obj.get<StringData>(column_key);
+        return { value.is_null(), 0, value.is_null() ? std::string() : std::string(value) };
+    }
+};
+
+template<>
+struct ReadKey<BinaryData> {
+    static GroupKey apply(const Obj& obj, ColKey column_key, int64_t)
+    {
+        const BinaryData value = obj.get<BinaryData>(column_key);
+        return { value.is_null(), 0, value.is_null() ? std::string() : std::string(value.data(), value.size()) };
+    }
+};
+
+template<>
+struct ReadKey<Timestamp> {
+    static GroupKey apply(const Obj& obj, ColKey column_key, int64_t bucket_ticks)
+    {
+        const Timestamp value = obj.get<Timestamp>(column_key);
+        if (value.is_null())
+            return { true, 0, {} };
+
+        const int64_t ticks = to_ticks(value);
+        return { false, bucket_ticks > 0 ? floor_to_bucket(ticks, bucket_ticks) : ticks, {} };
+    }
+};
+
+template<>
+struct ReadKey<Optional<Timestamp>> : ReadKey<Timestamp> {
+};
+
+}   // anonymous namespace
+
+extern "C" {
+
+// Groups results by the string, int, link or date property at key_property_ndx and computes aggregates
+// for every group. Dates are grouped by buckets of bucket_ticks, starting at 0 ticks, or by their exact
+// value if bucket_ticks is 0. Every group also reports the number of objects in it.
+REALM_EXPORT GroupByResult* results_group_by(Results& results, size_t key_property_ndx, int64_t bucket_ticks, const GroupAggregateSpec* aggregates, size_t aggregates_count, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        results.get_realm()->verify_thread();
+
+        const ObjectSchema& object_schema = results.get_object_schema();
+        const Property& key_property = object_schema.persisted_properties.at(key_property_ndx);
+        const auto key_type = key_property.type & ~realm::PropertyType::Nullable;
+        switch (key_type) {
+            case realm::PropertyType::String:
+            case realm::PropertyType::Int:
+            case realm::PropertyType::Object:
+            case realm::PropertyType::Date:
+                break;
+            default:
+                throw std::invalid_argument(util::format("Property '%1' can't be grouped by.", key_property.name));
+        }
+
+        std::vector<ResolvedSpec> specs;
+        specs.reserve(aggregates_count);
+        for (size_t i = 0; i < aggregates_count; ++i) {
+            specs.push_back(resolve_spec(object_schema, aggregates[i]));
+        }
+
+        auto result = std::make_unique<GroupByResult>();
+        result->key_type = key_property.type;
+
+        std::unordered_map<GroupKey, size_t, GroupKeyHash> groups;
+        std::vector<std::vector<Accumulator>> accumulators;
+
+        const auto read_key = PrimitiveDispatch<ReadKey, DispatchTypes::Values>::get(key_property.type);
+        const size_t size = results.size();
+        for (size_t i = 0; i < size; ++i) {
+            const Obj obj = results.get(i);
+            GroupKey key = read_key(obj, key_property.column_key, bucket_ticks);
+
+            auto inserted = groups.emplace(std::move(key), groups.size());
+            const size_t group_ndx = inserted.first->second;
+            if (inserted.second) {
+                const GroupKey& new_key = inserted.first->first;
+                result->null_keys.push_back(new_key.is_null);
+                if (key_type == realm::PropertyType::String)
+                    result->string_keys.push_back(new_key.string_value);
+                else
+                    result->int_keys.push_back(new_key.int_value);
+
+                result->counts.push_back(0);
+                accumulators.emplace_back(specs.size());
+            }
+
+            ++result->counts[group_ndx];
+            for (size_t spec_ndx = 0; spec_ndx < specs.size(); ++spec_ndx) {
+                accumulate(obj, specs[spec_ndx], accumulators[group_ndx][spec_ndx]);
+            }
+        }
+
+        result->values.resize(specs.size());
+        for (size_t spec_ndx = 0; spec_ndx < specs.size(); ++spec_ndx) {
+            auto& values = result->values[spec_ndx];
+            values.reserve(accumulators.size());
+            for (auto& group : accumulators) {
+                values.push_back(to_primitive(specs[spec_ndx], group[spec_ndx]));
+            }
+        }
+
+        return result.release();
+    });
+}
+
+REALM_EXPORT void group_by_result_destroy(GroupByResult* result)
+{
+    delete result;
+}
+
+REALM_EXPORT size_t group_by_result_get_group_count(const GroupByResult& result, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return result.counts.size();
+    });
+}
+
+// The type of the property the results were grouped by. String keys are read with group_by_result_get_string_keys
+// and all others with group_by_result_get_keys.
+REALM_EXPORT realm::PropertyType group_by_result_get_key_type(const GroupByResult& result, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return result.key_type;
+    });
+}
+
+// The group_by_result_get_* functions below write the values of up to count groups, starting at start,
+// and return the number of groups written.
+REALM_EXPORT size_t group_by_result_get_counts(const GroupByResult& result, size_t start, size_t count, size_t* counts, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        count = get_range_count(result.counts.size(), start, count, "Get from GroupByResult");
+        std::copy(result.counts.begin() + start, result.counts.begin() + start + count, counts);
+        return count;
+    });
+}
+
+// For int, link and date keys. Null keys are flagged in the optional null bitmap.
+REALM_EXPORT size_t group_by_result_get_keys(const GroupByResult& result, size_t start, size_t count, int64_t* keys, uint8_t* null_bitmap, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return read_range(result.int_keys.size(), start, count, "Get from GroupByResult", [&](size_t i, size_t ndx) {
+            keys[i] = result.int_keys[ndx];
+            set_null_bit(null_bitmap, i, result.null_keys[ndx]);
+        });
+    });
+}
+
+// For string keys, packed the same way as results_get_strings.
+REALM_EXPORT size_t group_by_result_get_string_keys(const GroupByResult& result, size_t start, size_t count, uint16_t* buffer, size_t buffer_size, size_t* offsets, uint8_t* null_bitmap, size_t* required_size, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        count = get_range_count(result.string_keys.size(), start, count, "Get from GroupByResult");
+        return pack_strings([&](size_t i) {
+            return result.null_keys[start + i] ? StringData() : StringData(result.string_keys[start + i]);
+        }, count, buffer, buffer_size, offsets, null_bitmap, required_size);
+    });
+}
+
+// The results of the aggregate at aggregate_ndx of the specs passed to results_group_by.
+REALM_EXPORT size_t group_by_result_get_values(const GroupByResult& result, size_t aggregate_ndx, size_t start, size_t count, PrimitiveValue* values, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        auto& aggregate_values = result.values.at(aggregate_ndx);
+        count = get_range_count(aggregate_values.size(), start, count, "Get from GroupByResult");
+        std::copy(aggregate_values.begin() + start, aggregate_values.begin() + start + count, values);
+        return count;
+    });
+}
+
+}   // extern "C"
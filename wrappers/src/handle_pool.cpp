@@ -0,0 +1,109 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include "handle_pool.hpp"
+#include "realm_export_decls.hpp"
+
+#include <realm.hpp>
+#include <object_accessor.hpp>
+#include <thread_safe_reference.hpp>
+
+using namespace realm;
+using namespace realm::binding;
+
+namespace {
+
+struct AtomicHandleCounters {
+    std::atomic<size_t> live{0};
+    std::atomic<size_t> peak{0};
+};
+
+AtomicHandleCounters handle_counters[static_cast<size_t>(HandleKind::Count)];
+
+void destroy(HandleKind kind, void* handle)
+{
+    switch (kind) {
+        case HandleKind::Object:
+            return destroy_handle(static_cast<Object*>(handle));
+        case HandleKind::Results:
+            return destroy_handle(static_cast<Results*>(handle));
+        case HandleKind::List:
+            return destroy_handle(static_cast<List*>(handle));
+        case HandleKind::Query:
+            return destroy_handle(static_cast<Query*>(handle));
+        case HandleKind::ThreadSafeReference:
+            return destroy_handle(static_cast<ThreadSafeReference*>(handle));
+        default:
+            REALM_UNREACHABLE();
+    }
+}
+
+}   // anonymous namespace
+
+namespace realm {
+namespace binding {
+
+void record_handle_created(HandleKind kind) noexcept
+{
+    auto& counters = handle_counters[static_cast<size_t>(kind)];
+    const size_t live = counters.live.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    size_t peak = counters.peak.load(std::memory_order_relaxed);
+    while (peak < live && !counters.peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+}
+
+void record_handle_destroyed(HandleKind kind) noexcept
+{
+    handle_counters[static_cast<size_t>(kind)].live.fetch_sub(1, std::memory_order_relaxed);
+}
+
+HandleCounters get_handle_counters(HandleKind kind) noexcept
+{
+    auto& counters = handle_counters[static_cast<size_t>(kind)];
+    return { counters.live.load(std::memory_order_relaxed), counters.peak.load(std::memory_order_relaxed) };
+}
+
+}   // namespace binding
+}   // namespace realm
+
+extern "C" {
+
+// Destroys count handles at once, handles[i] being of kind kinds[i]. Like the single handle destroy
+// functions, it must be called on the thread of the Realm the handles belong to - the managed side
+// batches the handles its finalizers release and calls this from the Realm's own thread.
+REALM_EXPORT void realm_destroy_handles(const HandleKind* kinds, void* const* handles, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        destroy(kinds[i], handles[i]);
+    }
+}
+
+// Writes the live and peak number of handles of each HandleKind into counters, which has room for
+// count entries. Returns the number of kinds there are.
+REALM_EXPORT size_t realm_get_handle_counters(HandleCounters* counters, size_t count)
+{
+    const size_t kinds = static_cast<size_t>(HandleKind::Count);
+    for (size_t i = 0; i < std::min(count, kinds); ++i) {
+        counters[i] = get_handle_counters(static_cast<HandleKind>(i));
+    }
+
+    return kinds;
+}
+
+}   // extern "C"
@@ -0,0 +1,191 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace realm {
+class Object;
+class Results;
+class List;
+class Query;
+class ThreadSafeReference;
+
+namespace binding {
+
+// The kinds of handles handed out to C#. Keep in sync with HandleKind in Realm/Handles/HandleKind.cs.
+enum class HandleKind : uint8_t {
+    Object,
+    Results,
+    List,
+    Query,
+    ThreadSafeReference,
+    Count
+};
+
+struct HandleCounters
+{
+    size_t live;
+    size_t peak;
+};
+
+template<typename T>
+struct HandleKindOf;
+
+template<> struct HandleKindOf<Object> { static constexpr HandleKind value = HandleKind::Object; };
+template<> struct HandleKindOf<Results> { static constexpr HandleKind value = HandleKind::Results; };
+template<> struct HandleKindOf<List> { static constexpr HandleKind value = HandleKind::List; };
+template<> struct HandleKindOf<Query> { static constexpr HandleKind value = HandleKind::Query; };
+template<> struct HandleKindOf<ThreadSafeReference> { static constexpr HandleKind value = HandleKind::ThreadSafeReference; };
+
+void record_handle_created(HandleKind kind) noexcept;
+void record_handle_destroyed(HandleKind kind) noexcept;
+HandleCounters get_handle_counters(HandleKind kind) noexcept;
+
+// Fixed size slots for one handle type. Every thread keeps a small cache of free slots so that
+// creating and destroying handles normally doesn't lock, and exchanges them with a shared free
+// list in batches. Slots are carved out of slabs that are never returned to the system, which
+// is fine as the number of live handles is bounded by what the managed side holds on to.
+template<typename T>
+class HandlePool {
+public:
+    static void* allocate()
+    {
+        ThreadCache& cache = thread_cache();
+        if (cache.count == 0)
+            cache.count = shared().take(cache.slots, batch_size);
+
+        return cache.slots[--cache.count];
+    }
+
+    static void deallocate(void* slot) noexcept
+    {
+        ThreadCache& cache = thread_cache();
+        if (cache.count == cache_size) {
+            cache.count -= batch_size;
+            shared().give(cache.slots + cache.count, batch_size);
+        }
+
+        cache.slots[cache.count++] = slot;
+    }
+
+private:
+    static constexpr size_t cache_size = 64;
+    static constexpr size_t batch_size = cache_size / 2;
+    static constexpr size_t slots_per_slab = 256;
+    static constexpr size_t slot_size = (sizeof(T) + alignof(T) - 1) / alignof(T) * alignof(T);
+
+    class SharedFreeList {
+    public:
+        size_t take(void** slots, size_t count)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_free.empty()) {
+                // make room for every slot up front, so that give never has to grow the vector
+                const size_t slot_count = m_slot_count + slots_per_slab;
+                if (m_free.capacity() < slot_count)
+                    m_free.reserve(std::max(slot_count, 2 * m_free.capacity()));
+
+                char* slab = static_cast<char*>(::operator new(slot_size * slots_per_slab));
+                m_slot_count = slot_count;
+                for (size_t i = 0; i < slots_per_slab; ++i) {
+                    m_free.push_back(slab + i * slot_size);
+                }
+            }
+
+            count = std::min(count, m_free.size());
+            std::copy(m_free.end() - count, m_free.end(), slots);
+            m_free.resize(m_free.size() - count);
+            return count;
+        }
+
+        void give(void* const* slots, size_t count) noexcept
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // m_free has room for every slot ever allocated, so this can't reallocate and throw
+            m_free.insert(m_free.end(), slots, slots + count);
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::vector<void*> m_free;
+        size_t m_slot_count = 0;
+    };
+
+    struct ThreadCache {
+        void* slots[cache_size];
+        size_t count = 0;
+
+        ~ThreadCache()
+        {
+            shared().give(slots, count);
+        }
+    };
+
+    static SharedFreeList& shared()
+    {
+        // intentionally leaked, so that thread caches can still return their slots during shutdown
+        static SharedFreeList* free_list = new SharedFreeList();
+        return *free_list;
+    }
+
+    static ThreadCache& thread_cache()
+    {
+        static thread_local ThreadCache cache;
+        return cache;
+    }
+};
+
+// Creates and destroys handles returned to C# through their HandlePool. Handles created
+// this way must be destroyed with destroy_handle.
+template<typename T, typename... Args>
+T* make_handle(Args&&... args)
+{
+    void* slot = HandlePool<T>::allocate();
+    try {
+        T* handle = new (slot) T(std::forward<Args>(args)...);
+        record_handle_created(HandleKindOf<T>::value);
+        return handle;
+    }
+    catch (...) {
+        HandlePool<T>::deallocate(slot);
+        throw;
+    }
+}
+
+template<typename T>
+void destroy_handle(T* handle)
+{
+    if (!handle)
+        return;
+
+    handle->~T();
+    HandlePool<T>::deallocate(handle);
+    record_handle_destroyed(HandleKindOf<T>::value);
+}
+
+}   // namespace binding
+}   // namespace realm
@@ -22,6 +22,7 @@
 
 #include "error_handling.hpp"
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
 #include "realm_export_decls.hpp"
 #include "wrapper_exceptions.hpp"
 #include "notifications_cs.hpp"
@@ -71,6 +72,76 @@ inline size_t find(List& list, T value, NativeException::Marshallable& ex)
     });
 }
 
+template<typename T>
+struct AddPrimitive {
+    static void apply(List& list, const PrimitiveValue& value)
+    {
+        list.add(PrimitiveTraits<T>::to_storage(value));
+    }
+};
+
+template<typename T>
+struct SetPrimitive {
+    static void apply(List& list, size_t list_ndx, const PrimitiveValue& value)
+    {
+        list.set(list_ndx, PrimitiveTraits<T>::to_storage(value));
+    }
+};
+
+template<typename T>
+struct InsertPrimitive {
+    static void apply(List& list, size_t list_ndx, const PrimitiveValue& value)
+    {
+        list.insert(list_ndx, PrimitiveTraits<T>::to_storage(value));
+    }
+};
+
+template<typename T>
+struct FindPrimitive {
+    static size_t apply(List& list, const PrimitiveValue& value)
+    {
+        return list.find(PrimitiveTraits<T>::to_storage(value));
+    }
+};
+
+template<typename T>
+inline Optional<T> to_optional(T value, bool has_value)
+{
+    return has_value ? Optional<T>(value) : Optional<T>(none);
+}
+
+// Bulk variants of the above, for count values in a typed buffer of the marshaled type (see write_marshaled).
+// Null values of nullable types are flagged in null_bitmap. list_ndx is ignored when adding.
+template<typename T>
+struct AddPrimitives {
+    static void apply(List& list, size_t, const void* values, const uint8_t* null_bitmap, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            list.add(read_marshaled<T>(values, null_bitmap, i));
+        }
+    }
+};
+
+template<typename T>
+struct SetPrimitives {
+    static void apply(List& list, size_t list_ndx, const void* values, const uint8_t* null_bitmap, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            list.set(list_ndx + i, read_marshaled<T>(values, null_bitmap, i));
+        }
+    }
+};
+
+template<typename T>
+struct InsertPrimitives {
+    static void apply(List& list, size_t list_ndx, const void* values, const uint8_t* null_bitmap, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            list.insert(list_ndx + i, read_marshaled<T>(values, null_bitmap, i));
+        }
+    }
+};
+
 extern "C" {
   
 REALM_EXPORT void list_add_object(List& list, const Object& object_ptr, NativeException::Marshallable& ex)
@@ -83,46 +154,171 @@ REALM_EXPORT void list_add_object(List& list, const Object& object_ptr, NativeEx
 REALM_EXPORT void list_add_primitive(List& list, PrimitiveValue& value, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch"
-        switch (value.type) {
-            case realm::PropertyType::Bool:
-                list.add(value.value.bool_value);
-                break;
-            case realm::PropertyType::Bool | realm::PropertyType::Nullable:
-                list.add(value.has_value ? Optional<bool>(value.value.bool_value) : Optional<bool>(none));
-                break;
-            case realm::PropertyType::Int:
-                list.add(value.value.int_value);
-                break;
-            case realm::PropertyType::Int | realm::PropertyType::Nullable:
-                list.add(value.has_value ? Optional<int64_t>(value.value.int_value) : Optional<int64_t>(none));
-                break;
-            case realm::PropertyType::Float:
-                list.add(value.value.float_value);
-                break;
-            case realm::PropertyType::Float | realm::PropertyType::Nullable:
-                list.add(value.has_value ? Optional<float>(value.value.float_value) : Optional<float>(none));
-                break;
-            case realm::PropertyType::Double:
-                list.add(value.value.double_value);
-                break;
-            case realm::PropertyType::Double | realm::PropertyType::Nullable:
-                list.add(value.has_value ? Optional<double>(value.value.double_value) : Optional<double>(none));
-                break;
-            case realm::PropertyType::Date:
-                list.add(from_ticks(value.value.int_value));
-                break;
-            case realm::PropertyType::Date | realm::PropertyType::Nullable:
-                list.add(value.has_value ? from_ticks(value.value.int_value) : Timestamp());
-                break;
-            default:
-                REALM_UNREACHABLE();
-        }
-#pragma GCC diagnostic pop
+        PrimitiveDispatch<AddPrimitive>::get(value.type)(list, value);
     });
 }
     
+// The _primitives variants take count values as a typed buffer (see AddPrimitives) and
+// apply them all in a single call.
+REALM_EXPORT void list_add_primitives(List& list, realm::PropertyType type, const void* values, const uint8_t* null_bitmap, size_t count, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        PrimitiveDispatch<AddPrimitives>::get(type)(list, 0, values, null_bitmap, count);
+    });
+}
+    
+// Type-specialized entry points for callers that know the element type statically. They skip
+// the PrimitiveValue dispatch altogether.
+REALM_EXPORT void list_add_bool(List& list, bool value, NativeException::Marshallable& ex)
+{
+    add(list, value, ex);
+}
+
+REALM_EXPORT void list_add_nullable_bool(List& list, bool value, bool has_value, NativeException::Marshallable& ex)
+{
+    add(list, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_add_int64(List& list, int64_t value, NativeException::Marshallable& ex)
+{
+    add(list, value, ex);
+}
+
+REALM_EXPORT void list_add_nullable_int64(List& list, int64_t value, bool has_value, NativeException::Marshallable& ex)
+{
+    add(list, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_add_float(List& list, float value, NativeException::Marshallable& ex)
+{
+    add(list, value, ex);
+}
+
+REALM_EXPORT void list_add_nullable_float(List& list, float value, bool has_value, NativeException::Marshallable& ex)
+{
+    add(list, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_add_double(List& list, double value, NativeException::Marshallable& ex)
+{
+    add(list, value, ex);
+}
+
+REALM_EXPORT void list_add_nullable_double(List& list, double value, bool has_value, NativeException::Marshallable& ex)
+{
+    add(list, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_add_timestamp_ticks(List& list, int64_t value, NativeException::Marshallable& ex)
+{
+    add(list, from_ticks(value), ex);
+}
+
+REALM_EXPORT void list_add_nullable_timestamp_ticks(List& list, int64_t value, bool has_value, NativeException::Marshallable& ex)
+{
+    add(list, has_value ? from_ticks(value) : Timestamp(), ex);
+}
+
+REALM_EXPORT void list_set_bool(List& list, size_t list_ndx, bool value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_set_nullable_bool(List& list, size_t list_ndx, bool value, bool has_value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_set_int64(List& list, size_t list_ndx, int64_t value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_set_nullable_int64(List& list, size_t list_ndx, int64_t value, bool has_value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_set_float(List& list, size_t list_ndx, float value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_set_nullable_float(List& list, size_t list_ndx, float value, bool has_value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_set_double(List& list, size_t list_ndx, double value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_set_nullable_double(List& list, size_t list_ndx, double value, bool has_value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_set_timestamp_ticks(List& list, size_t list_ndx, int64_t value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, from_ticks(value), ex);
+}
+
+REALM_EXPORT void list_set_nullable_timestamp_ticks(List& list, size_t list_ndx, int64_t value, bool has_value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, has_value ? from_ticks(value) : Timestamp(), ex);
+}
+
+REALM_EXPORT void list_insert_bool(List& list, size_t list_ndx, bool value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_insert_nullable_bool(List& list, size_t list_ndx, bool value, bool has_value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_insert_int64(List& list, size_t list_ndx, int64_t value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_insert_nullable_int64(List& list, size_t list_ndx, int64_t value, bool has_value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_insert_float(List& list, size_t list_ndx, float value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_insert_nullable_float(List& list, size_t list_ndx, float value, bool has_value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_insert_double(List& list, size_t list_ndx, double value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, value, ex);
+}
+
+REALM_EXPORT void list_insert_nullable_double(List& list, size_t list_ndx, double value, bool has_value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, to_optional(value, has_value), ex);
+}
+
+REALM_EXPORT void list_insert_timestamp_ticks(List& list, size_t list_ndx, int64_t value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, from_ticks(value), ex);
+}
+
+REALM_EXPORT void list_insert_nullable_timestamp_ticks(List& list, size_t list_ndx, int64_t value, bool has_value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, has_value ? from_ticks(value) : Timestamp(), ex);
+}
+
 REALM_EXPORT void list_add_string(List& list, uint16_t* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
 {
     if (has_value) {
@@ -134,6 +330,11 @@ REALM_EXPORT void list_add_string(List& list, uint16_t* value, size_t value_len,
     }
 }
     
+REALM_EXPORT void list_add_string_utf8(List& list, const char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
+{
+    add(list, has_value ? utf8_string_data(value, value_len) : StringData(), ex);
+}
+    
 REALM_EXPORT void list_add_binary(List& list, char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
 {
     if (has_value) {
@@ -157,43 +358,19 @@ REALM_EXPORT void list_set_primitive(List& list, size_t list_ndx, PrimitiveValue
             throw IndexOutOfRangeException("Insert into RealmList", list_ndx, count);
         }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch"
-        switch (value.type) {
-            case realm::PropertyType::Bool:
-                list.set(list_ndx, value.value.bool_value);
-                break;
-            case realm::PropertyType::Bool | realm::PropertyType::Nullable:
-                list.set(list_ndx, value.has_value ? Optional<bool>(value.value.bool_value) : Optional<bool>(none));
-                break;
-            case realm::PropertyType::Int:
-                list.set(list_ndx, value.value.int_value);
-                break;
-            case realm::PropertyType::Int | realm::PropertyType::Nullable:
-                list.set(list_ndx, value.has_value ? Optional<int64_t>(value.value.int_value) : Optional<int64_t>(none));
-                break;
-            case realm::PropertyType::Float:
-                list.set(list_ndx, value.value.float_value);
-                break;
-            case realm::PropertyType::Float | realm::PropertyType::Nullable:
-                list.set(list_ndx, value.has_value ? Optional<float>(value.value.float_value) : Optional<float>(none));
-                break;
-            case realm::PropertyType::Double:
-                list.set(list_ndx, value.value.double_value);
-                break;
-            case realm::PropertyType::Double | realm::PropertyType::Nullable:
-                list.set(list_ndx, value.has_value ? Optional<double>(value.value.double_value) : Optional<double>(none));
-                break;
-            case realm::PropertyType::Date:
-                list.set(list_ndx, from_ticks(value.value.int_value));
-                break;
-            case realm::PropertyType::Date | realm::PropertyType::Nullable:
-                list.set(list_ndx, value.has_value ? from_ticks(value.value.int_value) : Timestamp());
-                break;
-            default:
-                REALM_UNREACHABLE();
+        PrimitiveDispatch<SetPrimitive>::get(value.type)(list, list_ndx, value);
+    });
+}
+
+REALM_EXPORT void list_set_primitives(List& list, size_t list_ndx, realm::PropertyType type, const void* values, const uint8_t* null_bitmap, size_t count, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        const size_t size = list.size();
+        if (list_ndx > size || count > size - list_ndx) {
+            throw IndexOutOfRangeException("Set in RealmList", list_ndx + count, size);
         }
-#pragma GCC diagnostic pop
+
+        PrimitiveDispatch<SetPrimitives>::get(type)(list, list_ndx, values, null_bitmap, count);
     });
 }
 
@@ -208,6 +385,11 @@ REALM_EXPORT void list_set_string(List& list, size_t list_ndx, uint16_t* value,
     }
 }
 
+REALM_EXPORT void list_set_string_utf8(List& list, size_t list_ndx, const char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
+{
+    set(list, list_ndx, has_value ? utf8_string_data(value, value_len) : StringData(), ex);
+}
+
 REALM_EXPORT void list_set_binary(List& list, size_t list_ndx, char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
 {
     if (has_value) {
@@ -231,43 +413,19 @@ REALM_EXPORT void list_insert_primitive(List& list, size_t list_ndx, PrimitiveVa
             throw IndexOutOfRangeException("Insert into RealmList", list_ndx, count);
         }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch"
-        switch (value.type) {
-            case realm::PropertyType::Bool:
-                list.insert(list_ndx, value.value.bool_value);
-                break;
-            case realm::PropertyType::Bool | realm::PropertyType::Nullable:
-                list.insert(list_ndx, value.has_value ? Optional<bool>(value.value.bool_value) : Optional<bool>(none));
-                break;
-            case realm::PropertyType::Int:
-                list.insert(list_ndx, value.value.int_value);
-                break;
-            case realm::PropertyType::Int | realm::PropertyType::Nullable:
-                list.insert(list_ndx, value.has_value ? Optional<int64_t>(value.value.int_value) : Optional<int64_t>(none));
-                break;
-            case realm::PropertyType::Float:
-                list.insert(list_ndx, value.value.float_value);
-                break;
-            case realm::PropertyType::Float | realm::PropertyType::Nullable:
-                list.insert(list_ndx, value.has_value ? Optional<float>(value.value.float_value) : Optional<float>(none));
-                break;
-            case realm::PropertyType::Double:
-                list.insert(list_ndx, value.value.double_value);
-                break;
-            case realm::PropertyType::Double | realm::PropertyType::Nullable:
-                list.insert(list_ndx, value.has_value ? Optional<double>(value.value.double_value) : Optional<double>(none));
-                break;
-            case realm::PropertyType::Date:
-                list.insert(list_ndx, from_ticks(value.value.int_value));
-                break;
-            case realm::PropertyType::Date | realm::PropertyType::Nullable:
-                list.insert(list_ndx, value.has_value ? from_ticks(value.value.int_value) : Timestamp());
-                break;
-            default:
-                REALM_UNREACHABLE();
+        PrimitiveDispatch<InsertPrimitive>::get(value.type)(list, list_ndx, value);
+    });
+}
+
+REALM_EXPORT void list_insert_primitives(List& list, size_t list_ndx, realm::PropertyType type, const void* values, const uint8_t* null_bitmap, size_t count, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        const size_t size = list.size();
+        if (list_ndx > size) {
+            throw IndexOutOfRangeException("Insert into RealmList", list_ndx, size);
         }
-#pragma GCC diagnostic pop
+
+        PrimitiveDispatch<InsertPrimitives>::get(type)(list, list_ndx, values, null_bitmap, count);
     });
 }
 
@@ -282,6 +440,11 @@ REALM_EXPORT void list_insert_string(List& list, size_t list_ndx, uint16_t* valu
     }
 }
 
+REALM_EXPORT void list_insert_string_utf8(List& list, size_t list_ndx, const char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
+{
+    insert(list, list_ndx, has_value ? utf8_string_data(value, value_len) : StringData(), ex);
+}
+
 REALM_EXPORT void list_insert_binary(List& list, size_t list_ndx, char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
 {
     if (has_value) {
@@ -296,10 +459,12 @@ REALM_EXPORT Object* list_get_object(List& list, size_t ndx, NativeException::Ma
 {
     return handle_errors(ex, [&]() -> Object* {
         const size_t count = list.size();
-        if (ndx >= count)
-            throw IndexOutOfRangeException("Get from RealmList", ndx, count);
+        if (ndx >= count) {
+            set_index_out_of_range(ex, "Get from RealmList", ndx, count);
+            return nullptr;
+        }
         
-        return new Object(list.get_realm(), list.get_object_schema(), list.get(ndx));
+        return make_handle<Object>(list.get_realm(), list.get_object_schema(), list.get(ndx));
     });
 }
     
@@ -308,16 +473,42 @@ REALM_EXPORT void list_get_primitive(List& list, size_t ndx, PrimitiveValue& val
     collection_get_primitive(list, ndx, value, ex);
 }
     
+REALM_EXPORT size_t list_get_primitive_range(List& list, realm::PropertyType type, size_t start, size_t count, void* values, uint8_t* null_bitmap, NativeException::Marshallable& ex)
+{
+    return collection_get_primitive_range(list, type, start, count, values, null_bitmap, ex);
+}
+    
 REALM_EXPORT size_t list_get_string(List& list, size_t ndx, uint16_t* value, size_t value_len, bool* is_null, NativeException::Marshallable& ex)
 {
     return collection_get_string(list, ndx, value, value_len, is_null, ex);
 }
     
+REALM_EXPORT size_t list_get_strings(List& list, size_t start, size_t count, uint16_t* buffer, size_t buffer_size, size_t* offsets, uint8_t* null_bitmap, size_t* required_size, NativeException::Marshallable& ex)
+{
+    return collection_get_strings(list, start, count, buffer, buffer_size, offsets, null_bitmap, required_size, ex);
+}
+    
 REALM_EXPORT size_t list_get_binary(List& list, size_t ndx, char* return_buffer, size_t buffer_size, bool* is_null, NativeException::Marshallable& ex)
 {
     return collection_get_binary(list, ndx, return_buffer, buffer_size, is_null, ex);
 }
     
+// See collection_aggregate - property_ndx is ignored for lists of primitives.
+REALM_EXPORT void list_aggregate(List& list, size_t property_ndx, AggregateType type, PrimitiveValue& value, NativeException::Marshallable& ex)
+{
+    collection_aggregate(list, property_ndx, type, value, ex);
+}
+
+REALM_EXPORT bool list_get_string_view(List& list, size_t ndx, DataView& value, NativeException::Marshallable& ex)
+{
+    return collection_get_view<StringData>(list, ndx, value, ex);
+}
+
+REALM_EXPORT bool list_get_binary_view(List& list, size_t ndx, DataView& value, NativeException::Marshallable& ex)
+{
+    return collection_get_view<BinaryData>(list, ndx, value, ex);
+}
+    
 REALM_EXPORT size_t list_find_object(List& list, const Object& object_ptr, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
@@ -332,33 +523,7 @@ REALM_EXPORT size_t list_find_object(List& list, const Object& object_ptr, Nativ
 REALM_EXPORT size_t list_find_primitive(List& list, PrimitiveValue& value, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch"
-        switch (value.type) {
-            case realm::PropertyType::Bool:
-                return list.find(value.value.bool_value);
-            case realm::PropertyType::Bool | realm::PropertyType::Nullable:
-                return list.find(value.has_value ? Optional<bool>(value.value.bool_value) : Optional<bool>(none));
-            case realm::PropertyType::Int:
-                return list.find(value.value.int_value);
-            case realm::PropertyType::Int | realm::PropertyType::Nullable:
-                return list.find(value.has_value ? Optional<int64_t>(value.value.int_value) : Optional<int64_t>(none));
-            case realm::PropertyType::Float:
-                return list.find(value.value.float_value);
-            case realm::PropertyType::Float | realm::PropertyType::Nullable:
-                return list.find(value.has_value ? Optional<float>(value.value.float_value) : Optional<float>(none));
-            case realm::PropertyType::Double:
-                return list.find(value.value.double_value);
-            case realm::PropertyType::Double | realm::PropertyType::Nullable:
-                return list.find(value.has_value ? Optional<double>(value.value.double_value) : Optional<double>(none));
-            case realm::PropertyType::Date:
-                return list.find(from_ticks(value.value.int_value));
-            case realm::PropertyType::Date | realm::PropertyType::Nullable:
-                return list.find(value.has_value ? from_ticks(value.value.int_value) : Timestamp());
-            default:
-                REALM_UNREACHABLE();
-        }
-#pragma GCC diagnostic pop
+        return PrimitiveDispatch<FindPrimitive>::get(value.type)(list, value);
     });
 }
     
@@ -372,6 +537,11 @@ REALM_EXPORT size_t list_find_string(List& list, uint16_t* value, size_t value_l
     return find(list, StringData(), ex);
 }
     
+REALM_EXPORT size_t list_find_string_utf8(List& list, const char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
+{
+    return find(list, has_value ? utf8_string_data(value, value_len) : StringData(), ex);
+}
+    
 REALM_EXPORT size_t list_find_binary(List& list, char* value, size_t value_len, bool has_value, NativeException::Marshallable& ex)
 {
     if (has_value) {
@@ -409,7 +579,7 @@ REALM_EXPORT size_t list_size(List& list, NativeException::Marshallable& ex)
   
 REALM_EXPORT void list_destroy(List* list)
 {
-    delete list;
+    destroy_handle(list);
 }
     
 REALM_EXPORT ManagedNotificationTokenContext* list_add_notification_callback(List* list, void* managed_list, ManagedNotificationCallback callback, NativeException::Marshallable& ex)
@@ -449,14 +619,14 @@ REALM_EXPORT bool list_get_is_valid(const List& list, NativeException::Marshalla
 REALM_EXPORT ThreadSafeReference* list_get_thread_safe_reference(const List& list, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new ThreadSafeReference(list);
+        return make_handle<ThreadSafeReference>(list);
     });
 }
 
 REALM_EXPORT Results* list_snapshot(const List& list, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Results(list.snapshot());
+        return make_handle<Results>(list.snapshot());
     });
 }
 
@@ -470,7 +640,7 @@ REALM_EXPORT bool list_get_is_frozen(const List& list, NativeException::Marshall
 REALM_EXPORT List* list_freeze(const List& list, const SharedRealm& realm, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new List(list.freeze(realm));
+        return make_handle<List>(list.freeze(realm));
     });
 }
 
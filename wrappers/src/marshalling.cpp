@@ -16,24 +16,24 @@
 //
 ////////////////////////////////////////////////////////////////////////////
  
-#include <iostream>
 #include <realm.hpp>
 
 #include "marshalling.hpp"
 #include "error_handling.hpp"
+#include "string_transcoding.hpp"
 
 using namespace realm;
 
 //stringdata is utf8
-//cshapbuffer is a c# stringbuilder buffer marshalled as utf16 bufsize is the size of the csharp buffer measured in 16 bit words. The buffer is in fact one char larger than that, to make room for a terminating null character
-//this method will transcode the utf8 string data inside stringdata to utf16 and put the transcoded data in the buffer. the return value is the size of the buffer that was
-//actually used, measured in 16 bit characters, excluding a null terminator that is also put in
+//cshapbuffer is a c# stringbuilder buffer marshalled as utf16 bufsize is the size of the csharp buffer measured in 16 bit words
+//this method will transcode the utf8 string data inside stringdata to utf16 and put the transcoded data in the buffer in a single pass. the return value is the size of the buffer that was
+//actually used, measured in 16 bit characters. no null terminator is written, so callers must use the returned size rather than look for one
 //if the return sizee is larger than bufsize_in_16bit_words, the buffer was too small, this is a request to be called again with a larger buffer
 //note that this implementation will preserve null characters inside the string - but the C# interop marshalling stuff will truncate the string at the first null character anyways
 //To get around that, we would have to work with an untyped pointer.
 
+//throws InvalidUtf8Exception if the utf8 data pointed to by str cannot be translated to utf16
 //possible return values :
-//-1            :The utf8 data pointed to by str cannot be translated to utf16. it is invalid
 //>=0;<=bufsize :The data in str has been converted to data in csharpbuffer - return value is number of 16 bit characters in cshapbuffer that contains the converted data
 //>bufsize      :The buffer size is too small for the translated string. Please call again with a buffer of at least the size of the return value
 size_t realm::binding::stringdata_to_csharpstringbuffer(StringData str, uint16_t * csharpbuffer, size_t bufsize) //note bufsize is _in_16bit_words 
@@ -53,66 +53,98 @@ size_t realm::binding::stringdata_to_csharpstringbuffer(StringData str, uint16_t
     uint16_t* out_begin = csharpbuffer;
     uint16_t* out_end = csharpbuffer + bufsize;
 
-    typedef realm::util::Utf8x16<uint16_t, std::char_traits<char16_t>>Xcode;    //This might not work in old compilers (the std::char_traits<char16_t> ). 
+    //the utf16 form never has more code units than the utf8 form has bytes, so after the check above the output can't run out
+    if (utf8_to_utf16(in_begin, in_end, out_begin, out_end) != TranscodeResult::Ok) {
+        throw InvalidUtf8Exception();
+    }
 
-    size_t size = Xcode::find_utf16_buf_size(in_begin, in_end);//Figure how much space is actually needed
+    return out_begin - csharpbuffer; //transcode complete. return the number of 16-bit characters used in the buffer
+}
 
-    if (in_begin != in_end) {
-        std::cerr << "BAD UTF8 DATA IN stringdata_tocsharpbuffer :" << str.data() << "\n";
-        return -1;//bad uft8 data    
-    }
-    if (size > bufsize)
-        return size; //bufsize is too small. Return needed size
+namespace {
 
-      //the transcoded string fits in the buffer
+// Scratch space for accessors whose strings don't fit the inline buffer. Only one
+// accessor per thread can hold it at a time; any nested accessor uses the heap.
+struct Utf16StringAccessorScratch {
+    std::unique_ptr<char[]> data;
+    size_t capacity = 0;
+    bool in_use = false;
+};
 
-    in_begin = str.data();
-    in_end = str.data() + str.size();
+thread_local Utf16StringAccessorScratch scratch;
 
-    if (Xcode::to_utf16(in_begin, in_end, out_begin, out_end)) {
-        size_t chars_used = out_begin - csharpbuffer;
-        //csharpbuffer[chars_used-5]=0; //slightly ugly hack. C# looks for a null terminated string in the buffer, so we have to null terminate this string for C# to pick up where the end is
-        return (chars_used);        //transcode complete. return the number of 16-bit characters used in the buffer,excluding the null terminator
-    }
-    return -1;//bad utf8 data. this cannot happen
-}
+// Larger strings are rare enough that keeping their buffers alive per thread isn't worth it.
+const size_t max_scratch_size = 256 * 1024;
+
+} // anonymous namespace
 
 realm::binding::Utf16StringAccessor::Utf16StringAccessor(const uint16_t* csbuffer, size_t csbufsize)
+    : error(false)
+    , m_data(m_inline)
+    , m_size(0)
+    , m_uses_scratch(false)
 {
-    // For efficiency, if the incoming UTF-16 string is sufficiently
-    // small, we will choose an UTF-8 output buffer whose size (in
-    // bytes) is simply 4 times the number of 16-bit elements in the
-    // input. This is guaranteed to be enough. However, to avoid
-    // excessive over allocation, this is not done for larger input
-    // strings.
-
-    error = false;
-    typedef realm::util::Utf8x16<uint16_t, std::char_traits<char16_t>>Xcode;    //This might not work in old compilers (the std::char_traits<char16_t> ).     
-    size_t max_project_size = 48;
-
-    REALM_ASSERT(max_project_size <= std::numeric_limits<size_t>::max() / 4);
-
-    size_t u8buf_size;
-    if (csbufsize <= max_project_size) {
-        u8buf_size = csbufsize * 4;
+    // A UTF-16 code unit never needs more than 3 bytes of UTF-8, so as long as
+    // the worst case fits either the inline or the scratch buffer the string
+    // is converted in a single pass. Otherwise we start out with a heap buffer
+    // sized for ASCII and only grow it to the exact size once a non-ASCII
+    // code unit shows up.
+
+    REALM_ASSERT(csbufsize <= std::numeric_limits<size_t>::max() / 3);
+
+    const size_t worst_case_size = csbufsize * 3;
+    size_t u8buf_size = sizeof(m_inline);
+    if (worst_case_size > u8buf_size) {
+        if (!scratch.in_use && worst_case_size <= max_scratch_size) {
+            if (scratch.capacity < worst_case_size) {
+                scratch.data.reset(new char[worst_case_size]);
+                scratch.capacity = worst_case_size;
+            }
+            scratch.in_use = true;
+            m_uses_scratch = true;
+            m_data = scratch.data.get();
+            u8buf_size = scratch.capacity;
+        }
+        else {
+            u8buf_size = csbufsize;
+            m_heap.reset(new char[u8buf_size]);
+            m_data = m_heap.get();
+        }
     }
-    else {
-        const uint16_t* begin = csbuffer;
-        const uint16_t* end = csbuffer + csbufsize;
-        u8buf_size = Xcode::find_utf8_buf_size(begin, end);
+
+    const uint16_t* in_begin = csbuffer;
+    const uint16_t* in_end = csbuffer + csbufsize;
+    char* out_begin = m_data;
+    char* out_end = m_data + u8buf_size;
+
+    TranscodeResult result = utf16_to_utf8(in_begin, in_end, out_begin, out_end);
+    if (result == TranscodeResult::OutputExhausted) {
+        const size_t used = out_begin - m_data;
+        u8buf_size = used + utf8_size_for_utf16(in_begin, in_end);
+
+        std::unique_ptr<char[]> grown(new char[u8buf_size]);
+        std::copy(m_data, out_begin, grown.get());
+        m_heap = std::move(grown);
+        m_data = m_heap.get();
+
+        out_begin = m_data + used;
+        out_end = m_data + u8buf_size;
+        result = utf16_to_utf8(in_begin, in_end, out_begin, out_end);
     }
-    m_data.reset(new char[u8buf_size]);
-    {
-        const uint16_t* in_begin = csbuffer;
-        const uint16_t* in_end = csbuffer + csbufsize;
-        char* out_begin = m_data.get();
-        char* out_end = m_data.get() + u8buf_size;
-        if (!Xcode::to_utf8(in_begin, in_end, out_begin, out_end)) {
-            m_size = 0;
-            error = true;
-            return;//calling method should handle this. We can't throw exceptions
-        }
-        REALM_ASSERT(in_begin == in_end);
-        m_size = out_begin - m_data.get();
+
+    if (result != TranscodeResult::Ok) {
+        m_size = 0;
+        error = true;
+        return;//calling method should handle this. We can't throw exceptions
+    }
+
+    REALM_ASSERT(in_begin == in_end);
+    m_size = out_begin - m_data;
+}
+
+realm::binding::Utf16StringAccessor::~Utf16StringAccessor()
+{
+    if (m_uses_scratch) {
+        scratch.in_use = false;
     }
 }
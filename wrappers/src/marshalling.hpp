@@ -24,6 +24,7 @@
 #include "wrapper_exceptions.hpp"
 #include "error_handling.hpp"
 #include "timestamp_helpers.hpp"
+#include "string_transcoding.hpp"
 
 namespace realm {
 namespace binding {
@@ -47,6 +48,40 @@ struct StringValue
     const char* value;
 };
 
+// Points directly at string or binary data owned by the Realm. It is only valid until the
+// read transaction changes (refresh, begin/commit/cancel of a write) or the Realm is closed.
+struct DataView
+{
+    const char* data;
+    size_t size;
+};
+
+// Where a string or binary value of a PropertyValue lives in the arena passed alongside it.
+// offset is in bytes. size is in UTF-16 code units for strings and in bytes for binaries.
+struct ArenaValue
+{
+    size_t offset;
+    size_t size;
+};
+
+// A single property of an object, exchanged in bulk with the object_*_properties functions, or
+// an argument of a query. Dates are ticks and links the key of the target object. Strings (as UTF-16) and binaries
+// are kept in a separate arena so that the struct has a fixed size.
+struct PropertyValue
+{
+    realm::PropertyType type;
+    bool has_value;
+    char padding[6];
+
+    union {
+        bool bool_value;
+        int64_t int_value;
+        float float_value;
+        double double_value;
+        ArenaValue arena_value;
+    } value;
+};
+
 template <typename T>
 struct MarshaledVector
 {
@@ -68,67 +103,326 @@ struct MarshaledVector
     }
 };
     
+// Bit i of a null bitmap is set when the i-th value written alongside it is null.
+// The bitmap is optional, in which case null values are simply reported as 0.
+inline void set_null_bit(uint8_t* null_bitmap, size_t ndx, bool is_null)
+{
+    if (!null_bitmap)
+        return;
+    
+    const uint8_t mask = static_cast<uint8_t>(1 << (ndx % 8));
+    if (is_null)
+        null_bitmap[ndx / 8] |= mask;
+    else
+        null_bitmap[ndx / 8] &= ~mask;
+}
+    
+inline bool is_null_bit_set(const uint8_t* null_bitmap, size_t ndx)
+{
+    return null_bitmap && ((null_bitmap[ndx / 8] >> (ndx % 8)) & 1);
+}
+
+// The bulk getters read up to count elements, starting at start, of a collection of size elements.
+// Returns the number of elements to read, which is less than count if the end of the collection is
+// reached. Starting at the end reads nothing, but starting past it is an error.
+inline size_t get_range_count(size_t size, size_t start, size_t count, const char* location)
+{
+    if (start > size)
+        throw IndexOutOfRangeException(location, start, size);
+
+    return std::min(count, size - start);
+}
+
+// Same for a Results or List, which must be read on the thread of its Realm.
+template<typename Collection>
+inline size_t get_range_count(Collection& collection, size_t start, size_t count, const char* location)
+{
+    collection.get_realm()->verify_thread();
+    return get_range_count(collection.size(), start, count, location);
+}
+
+// Calls read(i, ndx) for every element of the range, i being the index in the caller's buffers and ndx
+// the one in the collection, or in a collection of source elements if source is a size. Returns the
+// number of elements read.
+template<typename Source, typename Read>
+inline size_t read_range(Source&& source, size_t start, size_t count, const char* location, Read&& read)
+{
+    count = get_range_count(std::forward<Source>(source), start, count, location);
+    for (size_t i = 0; i < count; ++i) {
+        read(i, start + i);
+    }
+
+    return count;
+}
+    
+// Maps a primitive to the type core stores it as and the type it is marshaled as, in a PrimitiveValue,
+// a PropertyValue or a typed buffer. T is the type of a required property, Optional<T> the nullable one.
+// Dates are marshaled as ticks and links as the value of their key. Timestamp and ObjKey have a null of
+// their own, so Optional<Timestamp> and Optional<ObjKey> only act as tags for the nullable types.
+template<typename T>
+struct PrimitiveMapping {
+    using StorageType = T;
+    using MarshaledType = T;
+
+    static bool is_null(const T&) { return false; }
+    static T to_marshaled(const T& stored) { return stored; }
+    static T from_marshaled(T value, bool) { return value; }
+};
+
+template<typename T>
+struct PrimitiveMapping<Optional<T>> {
+    using StorageType = Optional<T>;
+    using MarshaledType = T;
+
+    static bool is_null(const Optional<T>& stored) { return !stored; }
+    static T to_marshaled(const Optional<T>& stored) { return stored.value_or(T{}); }
+    static Optional<T> from_marshaled(T value, bool has_value) { return has_value ? Optional<T>(value) : Optional<T>(none); }
+};
+
+template<>
+struct PrimitiveMapping<Timestamp> {
+    using StorageType = Timestamp;
+    using MarshaledType = int64_t;
+
+    static bool is_null(const Timestamp& stored) { return stored.is_null(); }
+    static int64_t to_marshaled(const Timestamp& stored) { return stored.is_null() ? 0 : to_ticks(stored); }
+    static Timestamp from_marshaled(int64_t ticks, bool) { return from_ticks(ticks); }
+};
+
+template<>
+struct PrimitiveMapping<Optional<Timestamp>> : PrimitiveMapping<Timestamp> {
+    static Timestamp from_marshaled(int64_t ticks, bool has_value) { return has_value ? from_ticks(ticks) : Timestamp(); }
+};
+
+template<>
+struct PrimitiveMapping<ObjKey> {
+    using StorageType = ObjKey;
+    using MarshaledType = int64_t;
+
+    static bool is_null(const ObjKey& stored) { return !stored; }
+    static int64_t to_marshaled(const ObjKey& stored) { return stored ? stored.value : 0; }
+    static ObjKey from_marshaled(int64_t value, bool has_value) { return has_value ? ObjKey(value) : null_key; }
+};
+
+template<>
+struct PrimitiveMapping<Optional<ObjKey>> : PrimitiveMapping<ObjKey> {
+};
+
+// The member of the value union of a PrimitiveValue or PropertyValue that holds a marshaled T.
+template<typename T>
+struct PrimitiveField;
+
+template<>
+struct PrimitiveField<bool> {
+    template<typename Value>
+    static auto& get(Value& value) { return value.value.bool_value; }
+};
+
+template<>
+struct PrimitiveField<int64_t> {
+    template<typename Value>
+    static auto& get(Value& value) { return value.value.int_value; }
+};
+
+template<>
+struct PrimitiveField<float> {
+    template<typename Value>
+    static auto& get(Value& value) { return value.value.float_value; }
+};
+
+template<>
+struct PrimitiveField<double> {
+    template<typename Value>
+    static auto& get(Value& value) { return value.value.double_value; }
+};
+
+// Converts between a PrimitiveValue or PropertyValue and the type core stores T as.
+template<typename T>
+struct PrimitiveTraits : PrimitiveMapping<T> {
+    using Mapping = PrimitiveMapping<T>;
+    using typename Mapping::StorageType;
+    using typename Mapping::MarshaledType;
+
+    template<typename Value>
+    static StorageType to_storage(const Value& value)
+    {
+        return Mapping::from_marshaled(PrimitiveField<MarshaledType>::get(value), value.has_value);
+    }
+
+    template<typename Value>
+    static void from_storage(Value& value, const StorageType& stored)
+    {
+        value.has_value = !Mapping::is_null(stored);
+        PrimitiveField<MarshaledType>::get(value) = Mapping::to_marshaled(stored);
+    }
+};
+
+// The types a PrimitiveDispatch table covers. Each category includes the ones before it.
+enum class DispatchTypes {
+    Numerics,   // int, date, float and double
+    Primitives, // numerics and bool
+    Values,     // primitives, strings, binaries and links, but not lists
+};
+
+// A table of Operation<T>::apply for every type in a category, indexed by PropertyType, so that
+// operations pick their type-specialized implementation with a single lookup. T is the type that
+// PrimitiveTraits maps the property type to, or StringData, BinaryData and ObjKey for the other values.
+// This is the only place property types are mapped to C++ types - use it rather than a switch.
+// All Operation<T>::apply must have the same signature.
+template<template<typename> class Operation, DispatchTypes Types = DispatchTypes::Primitives>
+struct PrimitiveDispatch {
+    using Function = decltype(&Operation<int64_t>::apply);
+
+    // Returns nullptr for types outside of the category.
+    static Function find(realm::PropertyType type)
+    {
+        static_assert(static_cast<unsigned>(realm::PropertyType::Int) == 0 &&
+                      static_cast<unsigned>(realm::PropertyType::Bool) == 1 &&
+                      static_cast<unsigned>(realm::PropertyType::String) == 2 &&
+                      static_cast<unsigned>(realm::PropertyType::Data) == 3 &&
+                      static_cast<unsigned>(realm::PropertyType::Date) == 4 &&
+                      static_cast<unsigned>(realm::PropertyType::Float) == 5 &&
+                      static_cast<unsigned>(realm::PropertyType::Double) == 6 &&
+                      static_cast<unsigned>(realm::PropertyType::Object) == 7 &&
+                      static_cast<unsigned>(realm::PropertyType::Nullable) == 64,
+                      "The dispatch table is indexed by the values of PropertyType");
+
+        // Two entries per base type, required and nullable, in PropertyType order.
+        static constexpr Function table[] = {
+            entry<int64_t, DispatchTypes::Numerics>(), entry<Optional<int64_t>, DispatchTypes::Numerics>(),
+            entry<bool, DispatchTypes::Primitives>(), entry<Optional<bool>, DispatchTypes::Primitives>(),
+            entry<StringData, DispatchTypes::Values>(), entry<StringData, DispatchTypes::Values>(),
+            entry<BinaryData, DispatchTypes::Values>(), entry<BinaryData, DispatchTypes::Values>(),
+            entry<Timestamp, DispatchTypes::Numerics>(), entry<Optional<Timestamp>, DispatchTypes::Numerics>(),
+            entry<float, DispatchTypes::Numerics>(), entry<Optional<float>, DispatchTypes::Numerics>(),
+            entry<double, DispatchTypes::Numerics>(), entry<Optional<double>, DispatchTypes::Numerics>(),
+            entry<ObjKey, DispatchTypes::Values>(), entry<Optional<ObjKey>, DispatchTypes::Values>(),
+        };
+
+        const auto raw_type = static_cast<unsigned>(type);
+        const auto nullable = static_cast<unsigned>(realm::PropertyType::Nullable);
+        const size_t index = (raw_type & ~nullable) * 2 + ((raw_type & nullable) ? 1 : 0);
+        return index < sizeof(table) / sizeof(table[0]) ? table[index] : nullptr;
+    }
+
+    static Function get(realm::PropertyType type)
+    {
+        if (auto function = find(type))
+            return function;
+
+        throw PropertyTypeMismatchException(util::format("Values of type '%1' can't be used here.", string_for_property_type(type)));
+    }
+
+private:
+    // Operation<T> is only instantiated for the types in the category.
+    template<typename T, DispatchTypes Category>
+    static constexpr Function entry()
+    {
+        return apply_for<T>(std::integral_constant<bool, Category <= Types>());
+    }
+
+    template<typename T>
+    static constexpr Function apply_for(std::true_type)
+    {
+        return &Operation<T>::apply;
+    }
+
+    template<typename T>
+    static constexpr Function apply_for(std::false_type)
+    {
+        return nullptr;
+    }
+};
+
+struct GetObjectPrimitive {
+    template<typename T>
+    struct Operation {
+        static void apply(const Obj& obj, ColKey column_key, PrimitiveValue& value)
+        {
+            PrimitiveTraits<T>::from_storage(value, obj.get<typename PrimitiveTraits<T>::StorageType>(column_key));
+        }
+    };
+};
+
+inline void verify_primitive(const Property& property)
+{
+    if (!PrimitiveDispatch<GetObjectPrimitive::Operation>::find(property.type))
+        throw std::invalid_argument(util::format("Property '%1' is not a primitive.", property.name));
+}
+
+// Reads a persisted property of obj into value, which takes on the type of the property.
+inline void get_object_primitive(const Obj& obj, const Property& property, PrimitiveValue& value)
+{
+    verify_primitive(property);
+    
+    value.type = property.type;
+    PrimitiveDispatch<GetObjectPrimitive::Operation>::get(property.type)(obj, property.column_key, value);
+}
+
+template<typename Collection>
+struct GetPrimitive {
+    template<typename T>
+    struct Operation {
+        static void apply(Collection& collection, size_t ndx, PrimitiveValue& value)
+        {
+            PrimitiveTraits<T>::from_storage(value, collection.template get<typename PrimitiveTraits<T>::StorageType>(ndx));
+        }
+    };
+};
+
 template<typename Collection>
 void collection_get_primitive(Collection& collection, size_t ndx, PrimitiveValue& value, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
         const size_t count = collection.size();
         if (ndx >= count)
-            throw IndexOutOfRangeException("Get from Collection", ndx, count);
+            return set_index_out_of_range(ex, "Get from Collection", ndx, count);
         
-        value.has_value = true;
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wswitch"
-        switch (value.type) {
-            case realm::PropertyType::Bool:
-                value.value.bool_value = collection.template get<bool>(ndx);
-                break;
-            case realm::PropertyType::Bool | realm::PropertyType::Nullable: {
-                auto result = collection.template get<Optional<bool>>(ndx);
-                value.has_value = !!result;
-                value.value.bool_value = result.value_or(false);
-                break;
-            }
-            case realm::PropertyType::Int:
-                value.value.int_value = collection.template get<int64_t>(ndx);
-                break;
-            case realm::PropertyType::Int | realm::PropertyType::Nullable: {
-                auto result = collection.template get<Optional<int64_t>>(ndx);
-                value.has_value = !!result;
-                value.value.int_value = result.value_or(0);
-                break;
-            }
-            case realm::PropertyType::Float:
-                value.value.float_value = collection.template get<float>(ndx);
-                break;
-            case realm::PropertyType::Float | realm::PropertyType::Nullable: {
-                auto result = collection.template get<Optional<float>>(ndx);
-                value.has_value = !!result;
-                value.value.float_value = result.value_or((float)0);
-                break;
-            }
-            case realm::PropertyType::Double:
-                value.value.double_value = collection.template get<double>(ndx);
-                break;
-            case realm::PropertyType::Double | realm::PropertyType::Nullable: {
-                auto result = collection.template get<Optional<double>>(ndx);
-                value.has_value = !!result;
-                value.value.double_value = result.value_or((double)0);
-                break;
-            }
-            case realm::PropertyType::Date:
-                value.value.int_value = to_ticks(collection.template get<Timestamp>(ndx));
-                break;
-            case realm::PropertyType::Date | realm::PropertyType::Nullable: {
-                auto result = collection.template get<Timestamp>(ndx);
-                value.has_value = !result.is_null();
-                value.value.int_value = result.is_null() ? 0 : to_ticks(result);
-                break;
+        PrimitiveDispatch<GetPrimitive<Collection>::template Operation>::get(value.type)(collection, ndx, value);
+    });
+}
+
+// Writes stored to values[ndx] as a marshaled T and flags it in the optional null bitmap if it is null.
+template<typename T>
+inline void write_marshaled(const typename PrimitiveMapping<T>::StorageType& stored, void* values, uint8_t* null_bitmap, size_t ndx)
+{
+    using Mapping = PrimitiveMapping<T>;
+    static_cast<typename Mapping::MarshaledType*>(values)[ndx] = Mapping::to_marshaled(stored);
+    set_null_bit(null_bitmap, ndx, Mapping::is_null(stored));
+}
+
+// Reads values[ndx], a marshaled T, as the type core stores T as. null_bitmap flags the null values.
+template<typename T>
+inline typename PrimitiveMapping<T>::StorageType read_marshaled(const void* values, const uint8_t* null_bitmap, size_t ndx)
+{
+    using Mapping = PrimitiveMapping<T>;
+    return Mapping::from_marshaled(static_cast<const typename Mapping::MarshaledType*>(values)[ndx], !is_null_bit_set(null_bitmap, ndx));
+}
+
+template<typename Collection>
+struct GetPrimitiveRange {
+    template<typename T>
+    struct Operation {
+        static void apply(Collection& collection, size_t start, size_t count, void* values, uint8_t* null_bitmap)
+        {
+            for (size_t i = 0; i < count; ++i) {
+                write_marshaled<T>(collection.template get<typename PrimitiveMapping<T>::StorageType>(start + i), values, null_bitmap, i);
             }
-            default:
-                REALM_UNREACHABLE();
         }
-#pragma GCC diagnostic pop
+    };
+};
+
+// Reads up to count consecutive elements starting at start. values must point to an array of
+// the element type - int64_t for int and date (as ticks), bool, float or double - and nulls
+// are flagged in the optional null bitmap. Returns the number of elements read, which is less
+// than count if the end of the collection was reached.
+template<typename Collection>
+size_t collection_get_primitive_range(Collection& collection, realm::PropertyType type, size_t start, size_t count, void* values, uint8_t* null_bitmap, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        count = get_range_count(collection, start, count, "Get from Collection");
+        PrimitiveDispatch<GetPrimitiveRange<Collection>::template Operation>::get(type)(collection, start, count, values, null_bitmap);
+        return count;
     });
 }
     
@@ -137,39 +431,58 @@ inline T get(Collection& collection, size_t ndx, NativeException::Marshallable&
 {
     return handle_errors(ex, [&]() {
         const size_t count = collection.size();
-        if (ndx >= count)
-            throw IndexOutOfRangeException("Get from RealmList", ndx, count);
+        if (ndx >= count) {
+            set_index_out_of_range(ex, "Get from RealmList", ndx, count);
+            return T{};
+        }
         
         return collection.template get<T>(ndx);
     });
 }
     
+// Wraps UTF-8 bytes coming from C#. An empty managed array may arrive as a null pointer,
+// which core would read as a null string, so empty input always points at "".
+inline StringData utf8_string_data(const char* value, size_t value_len)
+{
+    return value_len == 0 ? StringData("", 0) : StringData(value, value_len);
+}
+
+// Transcodes a UTF-16 string coming from C# to UTF-8. Short strings are converted into
+// an inline buffer and longer ones into a per-thread scratch buffer, so constructing an
+// accessor normally doesn't allocate. The accessor must not outlive the calling scope.
 class Utf16StringAccessor {
 public:
     Utf16StringAccessor(const uint16_t* csbuffer, size_t csbufsize);
+    ~Utf16StringAccessor();
+
+    Utf16StringAccessor(const Utf16StringAccessor&) = delete;
+    Utf16StringAccessor& operator=(const Utf16StringAccessor&) = delete;
 
     operator realm::StringData() const noexcept
     {
-        return realm::StringData(m_data.get(), m_size);
+        return realm::StringData(m_data, m_size);
     }
 
     std::string to_string() const
     {
-        return std::string(m_data.get(), m_size);
+        return std::string(m_data, m_size);
     }
 
     operator std::string() const noexcept
     {
-        return std::string(m_data.get(), m_size);
+        return std::string(m_data, m_size);
     }
     
-    const char* data() const { return m_data.get();  }
+    const char* data() const { return m_data;  }
     size_t size() const { return m_size;  }
 
     bool error;
 private:
-    std::unique_ptr<char[]> m_data;
+    char* m_data;
     std::size_t m_size;
+    bool m_uses_scratch;
+    std::unique_ptr<char[]> m_heap;
+    char m_inline[256];
 };
 
 size_t stringdata_to_csharpstringbuffer(StringData str, uint16_t * csharpbuffer, size_t bufsize); //note bufsize is _in_16bit_words 
@@ -182,9 +495,111 @@ size_t collection_get_string(Collection& collection, size_t ndx, uint16_t* value
     if ((*is_null = result.is_null()))
         return 0;
     
-    return stringdata_to_csharpstringbuffer(result, value, value_len);
+    return handle_errors(ex, [&]() {
+        return stringdata_to_csharpstringbuffer(result, value, value_len);
+    });
+}
+
+// Transcodes up to count strings back to back into buffer. offsets must have room for count + 1
+// entries: the i-th string occupies [offsets[i], offsets[i + 1]), measured in 16-bit words. Null
+// strings are empty and flagged in the optional null bitmap.
+// Stops at the first string that doesn't fit in what is left of the buffer and returns the number
+// of strings written, so the caller can resume from there. required_size is set to the buffer size
+// needed to hold all count strings.
+template<typename Getter>
+size_t pack_strings(Getter&& get_string, size_t count, uint16_t* buffer, size_t buffer_size, size_t* offsets, uint8_t* null_bitmap, size_t* required_size)
+{
+    size_t used = 0;
+    offsets[0] = 0;
+    
+    size_t i = 0;
+    for (; i < count; ++i) {
+        const StringData value = get_string(i);
+        set_null_bit(null_bitmap, i, value.is_null());
+        
+        size_t written = 0;
+        if (!value.is_null()) {
+            written = stringdata_to_csharpstringbuffer(value, buffer + used, buffer_size - used);
+            if (written > buffer_size - used)
+                break;
+        }
+        
+        used += written;
+        offsets[i + 1] = used;
+    }
+    
+    const size_t packed = i;
+    size_t required = used;
+    for (; i < count; ++i) {
+        const StringData value = get_string(i);
+        required += utf16_size_for_utf8(value.data(), value.data() + value.size());
+    }
+    
+    *required_size = required;
+    return packed;
+}
+
+template<typename Collection>
+size_t collection_get_strings(Collection& collection, size_t start, size_t count, uint16_t* buffer, size_t buffer_size, size_t* offsets, uint8_t* null_bitmap, size_t* required_size, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        count = get_range_count(collection, start, count, "Get from Collection");
+        return pack_strings([&](size_t i) {
+            return collection.template get<StringData>(start + i);
+        }, count, buffer, buffer_size, offsets, null_bitmap, required_size);
+    });
 }
 
+// Copies strings and binaries into a caller-provided arena, one after the other. Once a value
+// doesn't fit, nothing more is copied but the size needed for all values keeps being counted,
+// so that the caller can retry with an arena of required_size() bytes.
+class ArenaWriter {
+public:
+    ArenaWriter(char* arena, size_t arena_size)
+        : m_arena(arena)
+        , m_arena_size(arena_size)
+    {
+    }
+
+    ArenaValue write(StringData value)
+    {
+        // strings are read as UTF-16 so they need to be aligned
+        m_used += m_used % sizeof(uint16_t);
+
+        const size_t available = m_exhausted ? 0 : (m_arena_size - std::min(m_used, m_arena_size)) / sizeof(uint16_t);
+        uint16_t* buffer = available ? reinterpret_cast<uint16_t*>(m_arena + m_used) : nullptr;
+        const size_t written = stringdata_to_csharpstringbuffer(value, buffer, available);
+
+        return advance(written, written * sizeof(uint16_t), written > available);
+    }
+
+    ArenaValue write(BinaryData value)
+    {
+        const size_t size = value.size();
+        const bool fits = !m_exhausted && m_used <= m_arena_size && size <= m_arena_size - m_used;
+        if (fits)
+            std::copy(value.data(), value.data() + size, m_arena + m_used);
+
+        return advance(size, size, !fits);
+    }
+
+    size_t required_size() const { return m_used; }
+
+private:
+    ArenaValue advance(size_t size, size_t byte_size, bool exhausted)
+    {
+        const ArenaValue result = { m_used, size };
+        m_exhausted = m_exhausted || exhausted;
+        m_used += byte_size;
+        return result;
+    }
+
+    char* m_arena;
+    size_t m_arena_size;
+    size_t m_used = 0;
+    bool m_exhausted = false;
+};
+
 template<typename Collection>
 size_t collection_get_binary(Collection& collection, size_t ndx, char* return_buffer, size_t buffer_size, bool* is_null, NativeException::Marshallable& ex)
 {
@@ -200,5 +615,121 @@ size_t collection_get_binary(Collection& collection, size_t ndx, char* return_bu
     return data_size;
 }
     
+// T is either StringData or BinaryData. Returns false if the value is null.
+template<typename T, typename Collection>
+bool collection_get_view(Collection& collection, size_t ndx, DataView& view, NativeException::Marshallable& ex)
+{
+    auto result = get<T>(collection, ndx, ex);
+    view = { result.data(), result.size() };
+    
+    return !result.is_null();
+}
+    
+enum class AggregateType : uint8_t {
+    Min,
+    Max,
+    Sum,
+    Average,
+};
+
+// Running count, sum, min and max of a sequence of values. Dates are aggregated as ticks. Partial
+// aggregates of parts of a sequence can be merged.
+template<typename T>
+struct PartialAggregate {
+    using SumType = typename std::conditional<std::is_integral<T>::value, int64_t, double>::type;
+
+    size_t count = 0;
+    SumType sum = 0;
+    T min = T{};
+    T max = T{};
+
+    void add(T value)
+    {
+        min = count == 0 ? value : std::min(min, value);
+        max = count == 0 ? value : std::max(max, value);
+        sum += value;
+        ++count;
+    }
+
+    void merge(const PartialAggregate& other)
+    {
+        if (other.count == 0)
+            return;
+
+        min = count == 0 ? other.min : std::min(min, other.min);
+        max = count == 0 ? other.max : std::max(max, other.max);
+        sum += other.sum;
+        count += other.count;
+    }
+};
+
+inline void aggregate_to_primitive(const util::Optional<double>& result, PrimitiveValue& value)
+{
+    value.type = realm::PropertyType::Double | realm::PropertyType::Nullable;
+    value.has_value = !!result;
+    value.value.double_value = result.value_or(0);
+}
+
+// type is the type of the aggregated values, which the result takes on when there is none.
+inline void aggregate_to_primitive(const util::Optional<Mixed>& result, realm::PropertyType type, PrimitiveValue& value)
+{
+    value.type = (type & ~realm::PropertyType::Flags) | realm::PropertyType::Nullable;
+    value.has_value = result && !result->is_null();
+    value.value.int_value = 0;
+    if (!value.has_value)
+        return;
+    
+    switch (result->get_type()) {
+        case type_Int:
+            value.type = realm::PropertyType::Int | realm::PropertyType::Nullable;
+            value.value.int_value = result->get_int();
+            break;
+        case type_Float:
+            value.type = realm::PropertyType::Float | realm::PropertyType::Nullable;
+            value.value.float_value = result->get_float();
+            break;
+        case type_Double:
+            value.type = realm::PropertyType::Double | realm::PropertyType::Nullable;
+            value.value.double_value = result->get_double();
+            break;
+        case type_Timestamp:
+            value.type = realm::PropertyType::Date | realm::PropertyType::Nullable;
+            value.value.int_value = to_ticks(result->get_timestamp());
+            break;
+        default:
+            throw PropertyTypeMismatchException(util::format("Aggregates of type '%1' can't be marshaled.", string_for_property_type(type)));
+    }
+}
+
+// Computes an aggregate of a collection of numbers or dates, or of the property at property_ndx
+// of a collection of objects. value takes on the (nullable) type of the result, which is a double
+// for averages, and has no value for the min, max or average of an empty collection.
+template<typename Collection>
+void collection_aggregate(Collection& collection, size_t property_ndx, AggregateType type, PrimitiveValue& value, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        ColKey column_key;
+        realm::PropertyType values_type = collection.get_type();
+        if (values_type == realm::PropertyType::Object) {
+            const Property& property = collection.get_object_schema().persisted_properties.at(property_ndx);
+            column_key = property.column_key;
+            values_type = property.type;
+        }
+        
+        switch (type) {
+            case AggregateType::Min:
+                return aggregate_to_primitive(collection.min(column_key), values_type, value);
+            case AggregateType::Max:
+                return aggregate_to_primitive(collection.max(column_key), values_type, value);
+            case AggregateType::Sum:
+                return aggregate_to_primitive(collection.sum(column_key), values_type, value);
+            case AggregateType::Average:
+                return aggregate_to_primitive(collection.average(column_key), value);
+            default:
+                throw std::invalid_argument("Unknown aggregate type.");
+        }
+    });
+}
+    
 } // namespace binding
 } // namespace realm
@@ -21,6 +21,7 @@
 #include "notifications_cs.hpp"
 #include "error_handling.hpp"
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
 #include "realm_export_decls.hpp"
 
 #include <realm.hpp>
@@ -35,7 +36,8 @@ template <typename T>
 inline T object_get(const Object& object, size_t property_ndx, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        verify_can_get(object);
+        if (!check_can_get(object, ex))
+            return T{};
 
         const ColKey column_key = get_column_key(object, property_ndx);
         return object.obj().get<T>(column_key);
@@ -46,7 +48,8 @@ template <typename T>
 inline bool object_get_nullable(const Object& object, size_t property_ndx, T& ret_value, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        verify_can_get(object);
+        if (!check_can_get(object, ex))
+            return false;
 
         auto result = object.obj().get<util::Optional<T>>(get_column_key(object, property_ndx));
         if (!result) {
@@ -58,6 +61,15 @@ inline bool object_get_nullable(const Object& object, size_t property_ndx, T& re
     });
 }
 
+template <typename T>
+inline bool object_get_view(const Object& object, size_t property_ndx, DataView& view, NativeException::Marshallable& ex)
+{
+    T field_data = object_get<T>(object, property_ndx, ex);
+    view = { field_data.data(), field_data.size() };
+
+    return !field_data.is_null();
+}
+
 template <typename T>
 inline void object_set(Object& object, size_t property_ndx, const T& value, NativeException::Marshallable& ex)
 {
@@ -68,6 +80,168 @@ inline void object_set(Object& object, size_t property_ndx, const T& value, Nati
     });
 }
 
+template <typename T>
+struct ReadProperty {
+    static void apply(const Obj& obj, ColKey column_key, PropertyValue& value, ArenaWriter&)
+    {
+        PrimitiveTraits<T>::from_storage(value, obj.get<typename PrimitiveTraits<T>::StorageType>(column_key));
+    }
+};
+
+template <typename T>
+inline void read_arena_value(const Obj& obj, ColKey column_key, PropertyValue& value, ArenaWriter& arena)
+{
+    const T result = obj.get<T>(column_key);
+    value.has_value = !result.is_null();
+    value.value.arena_value = value.has_value ? arena.write(result) : ArenaValue{ 0, 0 };
+}
+
+template <>
+struct ReadProperty<StringData> {
+    static void apply(const Obj& obj, ColKey column_key, PropertyValue& value, ArenaWriter& arena)
+    {
+        read_arena_value<StringData>(obj, column_key, value, arena);
+    }
+};
+
+template <>
+struct ReadProperty<BinaryData> {
+    static void apply(const Obj& obj, ColKey column_key, PropertyValue& value, ArenaWriter& arena)
+    {
+        read_arena_value<BinaryData>(obj, column_key, value, arena);
+    }
+};
+
+inline void read_property(const Obj& obj, const Property& property, PropertyValue& value, ArenaWriter& arena)
+{
+    value.type = property.type;
+    value.value.int_value = 0;
+
+    // lists are handles rather than values, so they still go through object_get_list. Their slot keeps
+    // the Array flag in its type, which tells it apart from a null value.
+    if (is_array(property.type)) {
+        value.has_value = false;
+        return;
+    }
+
+    const auto read = PrimitiveDispatch<ReadProperty, DispatchTypes::Values>::find(property.type);
+    if (!read)
+        throw PropertyTypeMismatchException(util::format("Property '%1' of type '%2' can't be read in bulk.", property.name, string_for_property_type(property.type)));
+
+    read(obj, property.column_key, value, arena);
+}
+
+template <typename T>
+inline void set_property_value(Obj& obj, ColKey column_key, const T& value)
+{
+    obj.set<T>(column_key, value);
+}
+
+template <typename T>
+inline void set_property_value(Obj& obj, ColKey column_key, const util::Optional<T>& value)
+{
+    if (value)
+        obj.set<T>(column_key, *value);
+    else
+        obj.set_null(column_key);
+}
+
+template <typename T>
+struct WriteProperty {
+    static void apply(Obj& obj, ColKey column_key, const PropertyValue& value, const char*)
+    {
+        set_property_value(obj, column_key, PrimitiveTraits<T>::to_storage(value));
+    }
+};
+
+template <>
+struct WriteProperty<StringData> {
+    static void apply(Obj& obj, ColKey column_key, const PropertyValue& value, const char* arena)
+    {
+        if (!value.has_value) {
+            obj.set_null(column_key);
+            return;
+        }
+
+        const ArenaValue& string = value.value.arena_value;
+        Utf16StringAccessor str(reinterpret_cast<const uint16_t*>(arena + string.offset), string.size);
+        obj.set<StringData>(column_key, str);
+    }
+};
+
+template <>
+struct WriteProperty<BinaryData> {
+    static void apply(Obj& obj, ColKey column_key, const PropertyValue& value, const char* arena)
+    {
+        if (!value.has_value) {
+            obj.set_null(column_key);
+            return;
+        }
+
+        const ArenaValue& binary = value.value.arena_value;
+        obj.set<BinaryData>(column_key, BinaryData(arena + binary.offset, binary.size));
+    }
+};
+
+// Whether value is what the property already holds. Primary keys can only be "set" to that.
+template <typename T>
+struct PropertyMatches {
+    static bool apply(const Obj& obj, ColKey column_key, const PropertyValue& value, const char*)
+    {
+        return obj.get<typename PrimitiveTraits<T>::StorageType>(column_key) == PrimitiveTraits<T>::to_storage(value);
+    }
+};
+
+template <>
+struct PropertyMatches<StringData> {
+    static bool apply(const Obj& obj, ColKey column_key, const PropertyValue& value, const char* arena)
+    {
+        const StringData current = obj.get<StringData>(column_key);
+        if (!value.has_value || current.is_null())
+            return !value.has_value && current.is_null();
+
+        const ArenaValue& string = value.value.arena_value;
+        Utf16StringAccessor str(reinterpret_cast<const uint16_t*>(arena + string.offset), string.size);
+        return current == StringData(str);
+    }
+};
+
+template <>
+struct PropertyMatches<BinaryData> {
+    static bool apply(const Obj& obj, ColKey column_key, const PropertyValue& value, const char* arena)
+    {
+        const BinaryData current = obj.get<BinaryData>(column_key);
+        if (!value.has_value || current.is_null())
+            return !value.has_value && current.is_null();
+
+        const ArenaValue& binary = value.value.arena_value;
+        return current == BinaryData(arena + binary.offset, binary.size);
+    }
+};
+
+inline void write_property(Obj& obj, const Property& property, const PropertyValue& value, const char* arena)
+{
+    if (is_array(property.type))
+        throw std::invalid_argument(util::format("List property '%1' can't be set directly", property.name));
+
+    if (!value.has_value && !is_nullable(property.type) && (property.type & ~PropertyType::Flags) != PropertyType::Object)
+        throw std::invalid_argument("Column is not nullable");
+
+    const auto write = PrimitiveDispatch<WriteProperty, DispatchTypes::Values>::find(property.type);
+    if (!write)
+        throw PropertyTypeMismatchException(util::format("Property '%1' of type '%2' can't be set in bulk.", property.name, string_for_property_type(property.type)));
+
+    if (property.is_primary) {
+        const auto matches = PrimitiveDispatch<PropertyMatches, DispatchTypes::Values>::get(property.type);
+        if (!matches(obj, property.column_key, value, arena))
+            throw ModifyPrimaryKeyException();
+
+        return;
+    }
+
+    write(obj, property.column_key, value, arena);
+}
+
 extern "C" {
     REALM_EXPORT bool object_get_is_valid(const Object& object, NativeException::Marshallable& ex)
     {
@@ -78,7 +252,7 @@ extern "C" {
 
     REALM_EXPORT void object_destroy(Object* object)
     {
-        delete object;
+        destroy_handle(object);
     }
 
     REALM_EXPORT void object_get_key(const Object& object, ObjKey& key, NativeException::Marshallable& ex)
@@ -98,9 +272,69 @@ extern "C" {
             if (!link_obj)
                 return nullptr;
 
-            const std::string target_name(ObjectStore::object_type_for_table_name(link_obj.get_table()->get_name()));
-            auto& target_schema = *object.realm()->schema().find(target_name);
-            return new Object(object.realm(), target_schema, link_obj);
+            auto& target_schema = get_object_schema_for_table(object.realm(), link_obj.get_table()->get_key());
+            return make_handle<Object>(object.realm(), target_schema, link_obj);
+        });
+    }
+
+    // The key path functions follow the links of property_chain from object and read the last property
+    // of the chain. A null link along the way is treated like a null terminal value.
+    REALM_EXPORT Object* object_get_key_path_object(const Object& object, const size_t* property_chain, size_t chain_length, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&]() -> Object* {
+            verify_can_get(object);
+
+            const KeyPath key_path(object.realm(), object.get_object_schema(), property_chain, chain_length);
+            if (key_path.terminal->type != (PropertyType::Object | PropertyType::Nullable))
+                throw std::invalid_argument(util::format("Property '%1' is not a link.", key_path.terminal->name));
+
+            const Obj obj = key_path.follow(object.obj());
+            if (!obj)
+                return nullptr;
+
+            const Obj link_obj = obj.get_linked_object(key_path.terminal->column_key);
+            if (!link_obj)
+                return nullptr;
+
+            auto& target_schema = get_object_schema_for_table(object.realm(), link_obj.get_table()->get_key());
+            return make_handle<Object>(object.realm(), target_schema, link_obj);
+        });
+    }
+
+    REALM_EXPORT void object_get_key_path_primitive(const Object& object, const size_t* property_chain, size_t chain_length, PrimitiveValue& value, NativeException::Marshallable& ex)
+    {
+        handle_errors(ex, [&]() {
+            verify_can_get(object);
+
+            const KeyPath key_path(object.realm(), object.get_object_schema(), property_chain, chain_length);
+            verify_primitive(*key_path.terminal);
+
+            const Obj obj = key_path.follow(object.obj());
+            if (!obj) {
+                value.type = key_path.terminal->type;
+                value.has_value = false;
+                return;
+            }
+
+            get_object_primitive(obj, *key_path.terminal, value);
+        });
+    }
+
+    REALM_EXPORT size_t object_get_key_path_string(const Object& object, const size_t* property_chain, size_t chain_length, uint16_t* string_buffer, size_t buffer_size, bool& is_null, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&]() -> size_t {
+            verify_can_get(object);
+
+            const KeyPath key_path(object.realm(), object.get_object_schema(), property_chain, chain_length);
+            if ((key_path.terminal->type & ~PropertyType::Nullable) != PropertyType::String)
+                throw PropertyTypeMismatchException(key_path.terminal->name, string_for_property_type(key_path.terminal->type), string_for_property_type(PropertyType::String));
+
+            const Obj obj = key_path.follow(object.obj());
+            const StringData value = obj ? obj.get<StringData>(key_path.terminal->column_key) : StringData();
+            if ((is_null = value.is_null()))
+                return 0;
+
+            return stringdata_to_csharpstringbuffer(value, string_buffer, buffer_size);
         });
     }
 
@@ -110,7 +344,7 @@ extern "C" {
             verify_can_get(object);
 
             const ColKey column_key = get_column_key(object, property_ndx);
-            return new List(object.realm(), object.obj(), column_key);
+            return make_handle<List>(object.realm(), object.obj(), column_key);
         });
     }
 
@@ -165,7 +399,9 @@ extern "C" {
             return 0;
         }
 
-        return stringdata_to_csharpstringbuffer(field_data, string_buffer, buffer_size);
+        return handle_errors(ex, [&]() {
+            return stringdata_to_csharpstringbuffer(field_data, string_buffer, buffer_size);
+        });
     }
 
     REALM_EXPORT size_t object_get_binary(const Object& object, size_t property_ndx, char* return_buffer, size_t buffer_size, bool& is_null, NativeException::Marshallable& ex)
@@ -187,6 +423,40 @@ extern "C" {
         return data_size;
     }
 
+    // The view variants skip transcoding and copying - see DataView for how long the data stays valid.
+    REALM_EXPORT bool object_get_string_view(const Object& object, size_t property_ndx, DataView& value, NativeException::Marshallable& ex)
+    {
+        return object_get_view<StringData>(object, property_ndx, value, ex);
+    }
+
+    REALM_EXPORT bool object_get_binary_view(const Object& object, size_t property_ndx, DataView& value, NativeException::Marshallable& ex)
+    {
+        return object_get_view<BinaryData>(object, property_ndx, value, ex);
+    }
+
+    // Reads every persisted property, in schema order, into values, which must have room for all of them.
+    // Strings and binaries are copied into arena. Returns the arena size needed to hold all of them - if it
+    // is larger than arena_size, their contents are incomplete and the call should be retried.
+    REALM_EXPORT size_t object_get_all_properties(const Object& object, PropertyValue* values, size_t values_count, char* arena, size_t arena_size, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&]() -> size_t {
+            if (!check_can_get(object, ex))
+                return 0;
+
+            const Obj& obj = object.obj();
+            const auto& properties = object.get_object_schema().persisted_properties;
+            if (values_count < properties.size())
+                throw IndexOutOfRangeException("Get all object properties", properties.size() - 1, values_count);
+
+            ArenaWriter writer(arena, arena_size);
+            for (size_t i = 0; i < properties.size(); ++i) {
+                read_property(obj, properties[i], values[i], writer);
+            }
+
+            return writer.required_size();
+        });
+    }
+
     REALM_EXPORT int64_t object_get_timestamp_ticks(const Object& object, size_t property_ndx, NativeException::Marshallable& ex)
     {
         return to_ticks(object_get<Timestamp>(object, property_ndx, ex));
@@ -211,17 +481,21 @@ extern "C" {
     {
         return handle_errors(ex, [&] {
             verify_can_get(object);
-            const Property& prop = object.get_object_schema().computed_properties[property_ndx];
-            REALM_ASSERT(prop.type == PropertyType::LinkingObjects);
+            const BacklinkOrigin origin(object.realm(), object.get_object_schema(), property_ndx);
 
-            const ObjectSchema& relationship = *object.realm()->schema().find(prop.object_type);
-            const Property& link = *relationship.property_for_name(prop.link_origin_property_name);
+            TableView backlink_view = object.obj().get_backlink_view(origin.table, origin.column_key);
+            return make_handle<Results>(object.realm(), std::move(backlink_view));
+        });
+    }
 
-            TableRef table = object.realm()->read_group().get_table(relationship.table_key);
-            const ColKey column = link.column_key;
+    // Same as the size of object_get_backlinks, without building the results.
+    REALM_EXPORT size_t object_get_backlink_count_for_property(const Object& object, size_t property_ndx, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&] {
+            verify_can_get(object);
+            const BacklinkOrigin origin(object.realm(), object.get_object_schema(), property_ndx);
 
-            TableView backlink_view = object.obj().get_backlink_view(table, column);
-            return new Results(object.realm(), std::move(backlink_view));
+            return object.obj().get_backlink_count(*origin.table, origin.column_key);
         });
     }
 
@@ -230,7 +504,7 @@ extern "C" {
         return handle_errors(ex, [&] {
             verify_can_get(object);
             
-            const ObjectSchema& source_object_schema = *object.realm()->schema().find(ObjectStore::object_type_for_table_name(source_table->get_name()));
+            const ObjectSchema& source_object_schema = get_object_schema_for_table(object.realm(), source_table->get_key());
             const Property& source_property = source_object_schema.persisted_properties[source_property_ndx];
         
             if (source_property.object_type != object.get_object_schema().name) {
@@ -238,7 +512,7 @@ extern "C" {
             }
         
             TableView backlink_view = object.obj().get_backlink_view(source_table, source_property.column_key);
-            return new Results(object.realm(), std::move(backlink_view));
+            return make_handle<Results>(object.realm(), std::move(backlink_view));
         });
     }
     
@@ -291,6 +565,12 @@ extern "C" {
         return object_set<StringData>(object, property_ndx, str, ex);
     }
     
+    // value must be valid UTF-8 - it is passed through to core as is.
+    REALM_EXPORT void object_set_string_utf8(Object& object, size_t property_ndx, const char* value, size_t value_len, NativeException::Marshallable& ex)
+    {
+        return object_set<StringData>(object, property_ndx, utf8_string_data(value, value_len), ex);
+    }
+    
     REALM_EXPORT void object_set_binary(Object& object, size_t property_ndx, char* value, size_t value_len, NativeException::Marshallable& ex)
     {
         return object_set<BinaryData>(object, property_ndx, BinaryData(value, value_len), ex);
@@ -301,6 +581,27 @@ extern "C" {
         return object_set<Timestamp>(object, property_ndx, from_ticks(value), ex);
     }
 
+    // Sets the persisted properties at property_indices[i] to values[i], with the layout written by
+    // object_get_all_properties. The type of each value is taken from the schema. Primary keys can't be
+    // changed, so they may only be given their current value. Stops at the first value that can't be set,
+    // leaving the ones before it set.
+    REALM_EXPORT void object_set_properties(Object& object, const size_t* property_indices, const PropertyValue* values, size_t count, const char* arena, NativeException::Marshallable& ex)
+    {
+        return handle_errors(ex, [&]() {
+            verify_can_set(object);
+
+            Obj obj = object.obj();
+            const auto& properties = object.get_object_schema().persisted_properties;
+            for (size_t i = 0; i < count; ++i) {
+                const size_t property_ndx = property_indices[i];
+                if (property_ndx >= properties.size())
+                    throw IndexOutOfRangeException("Set object property", property_ndx, properties.size());
+
+                write_property(obj, properties[property_ndx], values[i], arena);
+            }
+        });
+    }
+
     REALM_EXPORT void object_remove(Object& object, SharedRealm& realm, NativeException::Marshallable& ex)
     {
         handle_errors(ex, [&]() {
@@ -327,7 +628,7 @@ extern "C" {
     REALM_EXPORT ThreadSafeReference* object_get_thread_safe_reference(const Object& object, NativeException::Marshallable& ex)
     {
         return handle_errors(ex, [&]() {
-            return new ThreadSafeReference(object);
+            return make_handle<ThreadSafeReference>(object);
         });
     }
 
@@ -376,7 +677,7 @@ extern "C" {
     REALM_EXPORT Object* object_freeze(const Object& object, const SharedRealm& realm, NativeException::Marshallable& ex)
     {
         return handle_errors(ex, [&]() {
-            return new Object(object.freeze(realm));
+            return make_handle<Object>(object.freeze(realm));
         });
     }
 
@@ -34,6 +34,23 @@ namespace realm {
         object.realm()->verify_thread();
     }
     
+    // Non-throwing counterpart of verify_can_get for the hot getters. Closed realms and detached
+    // rows are reported through ex, in which case false is returned. Thread violations still throw.
+    inline bool check_can_get(const Object& object, NativeException::Marshallable& ex) {
+        if (object.realm()->is_closed()) {
+            set_error(ex, RealmErrorType::RealmClosed, StaticErrorMessage::RealmClosed);
+            return false;
+        }
+        
+        if (!object.is_valid()) {
+            set_error(ex, RealmErrorType::RealmRowDetached, StaticErrorMessage::RowDetached);
+            return false;
+        }
+        
+        object.realm()->verify_thread();
+        return true;
+    }
+    
     inline void verify_can_set(const Object& object) {
         if (object.realm()->is_closed())
             throw RealmClosedException();
@@ -47,4 +64,61 @@ namespace realm {
     inline ColKey get_column_key(const Object& object, const size_t property_index) {
         return object.get_object_schema().persisted_properties[property_index].column_key;
     }
+    
+    // The table and column that the linking objects property at property_ndx of object_schema is computed from.
+    struct BacklinkOrigin {
+        TableRef table;
+        ColKey column_key;
+        
+        BacklinkOrigin(const SharedRealm& realm, const ObjectSchema& object_schema, size_t property_ndx) {
+            const Property& prop = object_schema.computed_properties[property_ndx];
+            REALM_ASSERT(prop.type == PropertyType::LinkingObjects);
+            
+            const ObjectSchema& relationship = *realm->schema().find(prop.object_type);
+            const Property& link = *relationship.property_for_name(prop.link_origin_property_name);
+            
+            table = realm->read_group().get_table(relationship.table_key);
+            column_key = link.column_key;
+        }
+    };
+    
+    // A chain of persisted property indices, like the ones sort clauses take, resolved against the
+    // schema once so that it can be followed from any number of objects. All but the last property
+    // must be to-one links.
+    struct KeyPath {
+        std::vector<ColKey> links;
+        const Property* terminal;
+        
+        KeyPath(const SharedRealm& realm, const ObjectSchema& object_schema, const size_t* property_chain, size_t chain_length) {
+            if (chain_length == 0)
+                throw std::invalid_argument("Key path must not be empty.");
+            
+            const ObjectSchema* current_schema = &object_schema;
+            links.reserve(chain_length - 1);
+            for (size_t i = 0; i < chain_length - 1; ++i) {
+                const Property& property = current_schema->persisted_properties.at(property_chain[i]);
+                if (property.type != (PropertyType::Object | PropertyType::Nullable))
+                    throw std::invalid_argument(util::format("Property '%1.%2' is not a link.", current_schema->name, property.name));
+                
+                links.push_back(property.column_key);
+                
+                const TableKey target_key = realm->read_group().get_table(current_schema->table_key)->get_link_target(property.column_key)->get_key();
+                current_schema = &get_object_schema_for_table(realm, target_key);
+            }
+            
+            terminal = &current_schema->persisted_properties.at(property_chain[chain_length - 1]);
+        }
+        
+        // Returns the object the terminal property is read from, which is null if a link along the way is.
+        Obj follow(Obj obj) const {
+            for (auto& column_key : links) {
+                if (!obj)
+                    break;
+                
+                obj = obj.get_linked_object(column_key);
+            }
+            
+            return obj;
+        }
+    };
 }
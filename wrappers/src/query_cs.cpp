@@ -18,6 +18,7 @@
 
 #include <realm.hpp>
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
 #include "error_handling.hpp"
 #include "realm_export_decls.hpp"
 #include "object-store/src/shared_realm.hpp"
@@ -34,7 +35,7 @@ extern "C" {
 
 REALM_EXPORT void query_destroy(Query* query)
 {
-    delete query;
+    destroy_handle(query);
 }
 
 REALM_EXPORT size_t query_count(Query& query, NativeException::Marshallable& ex)
@@ -130,6 +131,50 @@ REALM_EXPORT void query_string_like(Query& query, ColKey column_key, uint16_t* v
     });
 }
 
+// The _utf8 variants take the string as UTF-8 bytes and pass it to core without
+// transcoding or copying. The bytes must be valid UTF-8.
+REALM_EXPORT void query_string_contains_utf8(Query& query, ColKey column_key, const char* value, size_t value_len, bool case_sensitive, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        query.contains(column_key, utf8_string_data(value, value_len), case_sensitive);
+    });
+}
+
+REALM_EXPORT void query_string_starts_with_utf8(Query& query, ColKey column_key, const char* value, size_t value_len, bool case_sensitive, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        query.begins_with(column_key, utf8_string_data(value, value_len), case_sensitive);
+    });
+}
+
+REALM_EXPORT void query_string_ends_with_utf8(Query& query, ColKey column_key, const char* value, size_t value_len, bool case_sensitive, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        query.ends_with(column_key, utf8_string_data(value, value_len), case_sensitive);
+    });
+}
+
+REALM_EXPORT void query_string_equal_utf8(Query& query, ColKey column_key, const char* value, size_t value_len, bool case_sensitive, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        query.equal(column_key, utf8_string_data(value, value_len), case_sensitive);
+    });
+}
+
+REALM_EXPORT void query_string_not_equal_utf8(Query& query, ColKey column_key, const char* value, size_t value_len, bool case_sensitive, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        query.not_equal(column_key, utf8_string_data(value, value_len), case_sensitive);
+    });
+}
+
+REALM_EXPORT void query_string_like_utf8(Query& query, ColKey column_key, const char* value, size_t value_len, bool case_sensitive, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        query.like(column_key, utf8_string_data(value, value_len), case_sensitive);
+    });
+}
+
 REALM_EXPORT void query_bool_equal(Query& query, ColKey column_key, bool value, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
@@ -402,7 +447,7 @@ REALM_EXPORT void query_null_not_equal(Query& query, ColKey column_key, NativeEx
 REALM_EXPORT Results* query_create_results(Query& query, SharedRealm& realm, DescriptorOrdering& descriptor, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Results(realm, query, descriptor);
+        return make_handle<Results>(realm, query, descriptor);
     });
 }
 
@@ -18,6 +18,11 @@
 
 #include <realm/parser/parser.hpp>
 #include <realm/parser/query_builder.hpp>
+#include <realm/array_basic.hpp>
+#include <realm/array_integer.hpp>
+#include <realm/array_timestamp.hpp>
+#include <realm/cluster.hpp>
+#include <realm/column_type_traits.hpp>
 
 #include <realm.hpp>
 #include <object_accessor.hpp>
@@ -26,12 +31,19 @@
 
 #include "error_handling.hpp"
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
 #include "notifications_cs.hpp"
 #include "wrapper_exceptions.hpp"
 #include "schema_cs.hpp"
+#include "object_cs.hpp"
 #include "keypath_helpers.hpp"
 #include "realm_export_decls.hpp"
 
+#include <exception>
+#include <system_error>
+#include <thread>
+#include <type_traits>
+
 using namespace realm;
 using namespace realm::binding;
 
@@ -40,18 +52,338 @@ inline T get(Results& results, size_t ndx, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
         const size_t count = results.size();
-        if (ndx >= count)
-            throw IndexOutOfRangeException("Get from RealmResults", ndx, count);
+        if (ndx >= count) {
+            set_index_out_of_range(ex, "Get from RealmResults", ndx, count);
+            return T{};
+        }
 
         return results.get<T>(ndx);
     });
 }
 
+template<typename T>
+struct ReadColumn {
+    static void apply(Results& results, ColKey column_key, size_t start, size_t count, void* values, uint8_t* null_bitmap)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            write_marshaled<T>(results.get(start + i).get<typename PrimitiveMapping<T>::StorageType>(column_key), values, null_bitmap, i);
+        }
+    }
+};
+
+// The result of results_parallel_aggregate. Values are null when there was nothing to aggregate,
+// and sum and average always are for dates.
+struct AggregateSummary
+{
+    size_t count;
+    PrimitiveValue sum;
+    PrimitiveValue min;
+    PrimitiveValue max;
+    PrimitiveValue average;
+};
+
+namespace {
+
+const size_t min_rows_per_chunk = 16 * 1024;
+
+size_t chunk_count_for(size_t size, size_t thread_count)
+{
+    return std::max<size_t>(1, std::min(thread_count, size / min_rows_per_chunk));
+}
+
+// Joins the threads it started when it goes out of scope, so that none outlives the data it reads
+// when the calling thread throws.
+class WorkerThreads {
+public:
+    explicit WorkerThreads(size_t capacity)
+    {
+        m_threads.reserve(capacity);
+    }
+
+    ~WorkerThreads()
+    {
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    // Returns false if the system is out of threads.
+    template<typename Func>
+    bool try_start(Func&& func)
+    {
+        try {
+            m_threads.emplace_back(std::forward<Func>(func));
+            return true;
+        }
+        catch (const std::system_error&) {
+            return false;
+        }
+    }
+
+private:
+    std::vector<std::thread> m_threads;
+};
+
+// Runs aggregate_chunk(chunk, partial) for chunk_count chunks concurrently, the first one on the
+// calling thread, and merges the results. Only safe for frozen data.
+template<typename T, typename AggregateChunk>
+PartialAggregate<T> aggregate_in_parallel(size_t chunk_count, AggregateChunk aggregate_chunk)
+{
+    std::vector<PartialAggregate<T>> partials(chunk_count);
+    std::vector<std::exception_ptr> errors(chunk_count);
+    auto run_chunk = [&](size_t chunk) {
+        try {
+            aggregate_chunk(chunk, partials[chunk]);
+        }
+        catch (...) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    {
+        WorkerThreads workers(chunk_count - 1);
+        for (size_t chunk = 1; chunk < chunk_count; ++chunk) {
+            // out of threads, so do it ourselves
+            if (!workers.try_start([&run_chunk, chunk]() { run_chunk(chunk); }))
+                run_chunk(chunk);
+        }
+
+        run_chunk(0);
+    }
+
+    PartialAggregate<T> result;
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+        if (errors[chunk])
+            std::rethrow_exception(errors[chunk]);
+
+        result.merge(partials[chunk]);
+    }
+
+    return result;
+}
+
+template<typename T>
+void set_summary_value(PrimitiveValue& value, realm::PropertyType type, bool has_value, T result)
+{
+    value.type = type | realm::PropertyType::Nullable;
+    value.has_value = has_value;
+    value.value.int_value = 0;
+    if (has_value)
+        PrimitiveField<T>::get(value) = result;
+}
+
+template<typename T>
+void summarize(const PartialAggregate<T>& aggregate, realm::PropertyType type, AggregateSummary& summary)
+{
+    const bool has_values = aggregate.count > 0;
+    const bool is_date = type == realm::PropertyType::Date;
+
+    summary.count = aggregate.count;
+    set_summary_value(summary.min, type, has_values, aggregate.min);
+    set_summary_value(summary.max, type, has_values, aggregate.max);
+    set_summary_value(summary.sum, std::is_integral<T>::value ? realm::PropertyType::Int : realm::PropertyType::Double, has_values && !is_date, aggregate.sum);
+    set_summary_value(summary.average, realm::PropertyType::Double, has_values && !is_date, static_cast<double>(aggregate.sum) / std::max<size_t>(aggregate.count, 1));
+}
+
+// Aggregates the column of T at property. Results of a whole table are read straight from the cluster
+// leaves, every chunk taking every chunk_count-th cluster. Other results are read through their TableView.
+template<typename T>
+struct ParallelAggregate {
+    using Mapping = PrimitiveMapping<T>;
+    using StorageType = typename Mapping::StorageType;
+    using Value = typename Mapping::MarshaledType;
+
+    static void add(PartialAggregate<Value>& partial, const StorageType& stored)
+    {
+        if (!Mapping::is_null(stored))
+            partial.add(Mapping::to_marshaled(stored));
+    }
+
+    static PartialAggregate<Value> aggregate_table(const Table& table, ColKey column_key, size_t thread_count)
+    {
+        using Leaf = typename ColumnTypeTraits<StorageType>::cluster_leaf_type;
+
+        const size_t chunk_count = chunk_count_for(table.size(), thread_count);
+        return aggregate_in_parallel<Value>(chunk_count, [&](size_t chunk, PartialAggregate<Value>& partial) {
+            Leaf leaf(table.get_alloc());
+            size_t cluster_ndx = 0;
+            table.traverse_clusters([&](const Cluster* cluster) {
+                if (cluster_ndx++ % chunk_count == chunk) {
+                    cluster->init_leaf(column_key, &leaf);
+                    for (size_t i = 0, size = cluster->node_size(); i < size; ++i) {
+                        add(partial, leaf.get(i));
+                    }
+                }
+                return false;
+            });
+        });
+    }
+
+    static PartialAggregate<Value> aggregate_view(TableView& view, ColKey column_key, size_t thread_count)
+    {
+        const size_t size = view.size();
+        const size_t chunk_count = chunk_count_for(size, thread_count);
+        return aggregate_in_parallel<Value>(chunk_count, [&](size_t chunk, PartialAggregate<Value>& partial) {
+            for (size_t i = size * chunk / chunk_count, end = size * (chunk + 1) / chunk_count; i < end; ++i) {
+                const Obj obj = view.get(i);
+                add(partial, obj.get<StorageType>(column_key));
+            }
+        });
+    }
+
+    static void apply(Results& results, const Property& property, size_t thread_count, AggregateSummary& summary)
+    {
+        if (results.get_mode() == Results::Mode::Table) {
+            summarize(aggregate_table(*results.get_table(), property.column_key, thread_count), property.type & ~realm::PropertyType::Nullable, summary);
+        }
+        else {
+            TableView view = results.get_tableview();
+            summarize(aggregate_view(view, property.column_key, thread_count), property.type & ~realm::PropertyType::Nullable, summary);
+        }
+    }
+};
+
+// Binds the $n placeholders of a query string to values passed from C#. Strings are converted
+// once up front, since the query builder may ask for the same argument more than once.
+class PropertyValueArguments : public query_builder::Arguments {
+public:
+    PropertyValueArguments(const PropertyValue* arguments, size_t count, const char* arena)
+        : m_arguments(arguments)
+        , m_count(count)
+        , m_arena(arena)
+        , m_strings(count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            const PropertyValue& argument = arguments[i];
+            if (argument.type == realm::PropertyType::String && argument.has_value) {
+                const ArenaValue& string = argument.value.arena_value;
+                m_strings[i] = Utf16StringAccessor(reinterpret_cast<const uint16_t*>(arena + string.offset), string.size).to_string();
+            }
+        }
+    }
+
+    bool bool_for_argument(size_t ndx) override
+    {
+        return get(ndx, realm::PropertyType::Bool).value.bool_value;
+    }
+
+    long long long_for_argument(size_t ndx) override
+    {
+        return get(ndx, realm::PropertyType::Int).value.int_value;
+    }
+
+    float float_for_argument(size_t ndx) override
+    {
+        return static_cast<float>(number_for_argument(ndx));
+    }
+
+    double double_for_argument(size_t ndx) override
+    {
+        return number_for_argument(ndx);
+    }
+
+    StringData string_for_argument(size_t ndx) override
+    {
+        get(ndx, realm::PropertyType::String);
+        return m_strings[ndx];
+    }
+
+    BinaryData binary_for_argument(size_t ndx) override
+    {
+        const ArenaValue& binary = get(ndx, realm::PropertyType::Data).value.arena_value;
+        return BinaryData(m_arena + binary.offset, binary.size);
+    }
+
+    Timestamp timestamp_for_argument(size_t ndx) override
+    {
+        return from_ticks(get(ndx, realm::PropertyType::Date).value.int_value);
+    }
+
+    ObjKey object_index_for_argument(size_t ndx) override
+    {
+        return ObjKey(get(ndx, realm::PropertyType::Object).value.int_value);
+    }
+
+    ObjectId objectid_for_argument(size_t) override
+    {
+        throw std::invalid_argument("ObjectId query arguments are not supported.");
+    }
+
+    Decimal128 decimal128_for_argument(size_t) override
+    {
+        throw std::invalid_argument("Decimal128 query arguments are not supported.");
+    }
+
+    bool is_argument_null(size_t ndx) override
+    {
+        return !at(ndx).has_value;
+    }
+
+private:
+    const PropertyValue& at(size_t ndx) const
+    {
+        if (ndx >= m_count)
+            throw IndexOutOfRangeException("Query argument", ndx, m_count);
+
+        return m_arguments[ndx];
+    }
+
+    const PropertyValue& get(size_t ndx, realm::PropertyType type) const
+    {
+        const PropertyValue& argument = at(ndx);
+        if (argument.type != type)
+            throw std::invalid_argument(util::format("Query argument $%1 is of type %2, but %3 was expected.", ndx, string_for_property_type(argument.type), string_for_property_type(type)));
+
+        if (!argument.has_value)
+            throw std::invalid_argument(util::format("Query argument $%1 is null.", ndx));
+
+        return argument;
+    }
+
+    // Whole numbers are accepted where floating point ones are expected, so that C# callers
+    // don't have to match the exact type of the property they compare against.
+    double number_for_argument(size_t ndx) const
+    {
+        const PropertyValue& argument = at(ndx);
+        switch (argument.type) {
+            case realm::PropertyType::Int:
+                return static_cast<double>(get(ndx, argument.type).value.int_value);
+            case realm::PropertyType::Float:
+                return get(ndx, argument.type).value.float_value;
+            default:
+                return get(ndx, realm::PropertyType::Double).value.double_value;
+        }
+    }
+
+    const PropertyValue* m_arguments;
+    size_t m_count;
+    const char* m_arena;
+    std::vector<std::string> m_strings;
+};
+
+Results* get_filtered_results(const Results& results, uint16_t* query_buf, size_t query_len, query_builder::Arguments& arguments)
+{
+    Utf16StringAccessor query_string(query_buf, query_len);
+    auto query = results.get_query();
+    auto const &realm = results.get_realm();
+
+    auto result = parse_query(realm, query_string.to_string());
+    auto mapping = get_keypath_mapping(realm);
+
+    query_builder::apply_predicate(query, result->predicate, arguments, *mapping);
+
+    DescriptorOrdering ordering;
+    query_builder::apply_ordering(ordering, query.get_table(), result->ordering);
+    return make_handle<Results>(realm, std::move(query), std::move(ordering));
+}
+
+}   // anonymous namespace
+
 extern "C" {
 
 REALM_EXPORT void results_destroy(Results* results)
 {
-    delete results;
+    destroy_handle(results);
 }
 
 // TODO issue https://github.com/realm/realm-dotnet-private/issues/40 added as needs
@@ -65,15 +397,14 @@ REALM_EXPORT bool results_is_same_internal_results(Results* lhs, Results* rhs, N
 
 REALM_EXPORT Object* results_get_object(Results& results, size_t ndx, NativeException::Marshallable& ex)
 {
-    return handle_errors(ex, [&]() {
-        try {
-            results.get_realm()->verify_thread();
+    return handle_errors(ex, [&]() -> Object* {
+        results.get_realm()->verify_thread();
 
-            return new Object(results.get_realm(), results.get_object_schema(), results.get(ndx));
-        }
-        catch (std::out_of_range) {
-            return static_cast<Object*>(nullptr);
-        }
+        // enumeration relies on getting null past the end, so this isn't an error
+        if (ndx >= results.size())
+            return nullptr;
+
+        return make_handle<Object>(results.get_realm(), results.get_object_schema(), results.get(ndx));
     });
 }
 
@@ -82,16 +413,157 @@ REALM_EXPORT void results_get_primitive(Results& results, size_t ndx, PrimitiveV
     collection_get_primitive(results, ndx, value, ex);
 }
 
+REALM_EXPORT size_t results_get_primitive_range(Results& results, realm::PropertyType type, size_t start, size_t count, void* values, uint8_t* null_bitmap, NativeException::Marshallable& ex)
+{
+    return collection_get_primitive_range(results, type, start, count, values, null_bitmap, ex);
+}
+
 REALM_EXPORT size_t results_get_string(Results& results, size_t ndx, uint16_t* value, size_t value_len, bool* is_null, NativeException::Marshallable& ex)
 {
     return collection_get_string(results, ndx, value, value_len, is_null, ex);
 }
 
+REALM_EXPORT size_t results_get_strings(Results& results, size_t start, size_t count, uint16_t* buffer, size_t buffer_size, size_t* offsets, uint8_t* null_bitmap, size_t* required_size, NativeException::Marshallable& ex)
+{
+    return collection_get_strings(results, start, count, buffer, buffer_size, offsets, null_bitmap, required_size, ex);
+}
+
 REALM_EXPORT size_t results_get_binary(Results& results, size_t ndx, char* return_buffer, size_t buffer_size, bool* is_null, NativeException::Marshallable& ex)
 {
     return collection_get_binary(results, ndx, return_buffer, buffer_size, is_null, ex);
 }
 
+REALM_EXPORT bool results_get_string_view(Results& results, size_t ndx, DataView& value, NativeException::Marshallable& ex)
+{
+    return collection_get_view<StringData>(results, ndx, value, ex);
+}
+
+REALM_EXPORT bool results_get_binary_view(Results& results, size_t ndx, DataView& value, NativeException::Marshallable& ex)
+{
+    return collection_get_view<BinaryData>(results, ndx, value, ex);
+}
+
+// Reads the property at property_ndx of up to count objects, starting at start, in a single call.
+// values must point to an array of the property's type - int64_t for int and date (as ticks),
+// bool, float or double. Returns the number of values read, which is less than count
+// if the end of the results was reached.
+REALM_EXPORT size_t results_get_column_values(Results& results, size_t property_ndx, size_t start, size_t count, void* values, uint8_t* null_bitmap, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() -> size_t {
+        count = get_range_count(results, start, count, "Get from RealmResults");
+
+        const Property& property = results.get_object_schema().persisted_properties[property_ndx];
+        const auto read_column = PrimitiveDispatch<ReadColumn>::find(property.type);
+        if (!read_column)
+            throw std::invalid_argument(util::format("Property '%1' can't be read as a column of values.", property.name));
+
+        read_column(results, property.column_key, start, count, values, null_bitmap);
+
+        return count;
+    });
+}
+
+// Same as results_get_strings, but reads the string property at property_ndx of each object.
+REALM_EXPORT size_t results_get_string_column_values(Results& results, size_t property_ndx, size_t start, size_t count, uint16_t* buffer, size_t buffer_size, size_t* offsets, uint8_t* null_bitmap, size_t* required_size, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        count = get_range_count(results, start, count, "Get from RealmResults");
+
+        const ColKey column_key = results.get_object_schema().persisted_properties[property_ndx].column_key;
+        return pack_strings([&](size_t i) {
+            return results.get(start + i).get<StringData>(column_key);
+        }, count, buffer, buffer_size, offsets, null_bitmap, required_size);
+    });
+}
+
+// Writes the keys of up to count objects, starting at start, so that their properties can be read
+// with the table_get_* functions without creating an Object for each. Returns the number of keys
+// written, which is less than count if the end of the results was reached.
+REALM_EXPORT size_t results_get_keys(Results& results, size_t start, size_t count, ObjKey* keys, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return read_range(results, start, count, "Get from RealmResults", [&](size_t i, size_t ndx) {
+            keys[i] = results.get(ndx).get_key();
+        });
+    });
+}
+
+// Follows property_chain, as object_get_key_path_object does, from up to count objects starting at start
+// and writes the keys of the objects it ends at, or a null key. Returns the number of keys written.
+REALM_EXPORT size_t results_get_key_path_keys(Results& results, const size_t* property_chain, size_t chain_length, size_t start, size_t count, ObjKey* keys, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        const KeyPath key_path(results.get_realm(), results.get_object_schema(), property_chain, chain_length);
+        if (key_path.terminal->type != (PropertyType::Object | PropertyType::Nullable))
+            throw std::invalid_argument(util::format("Property '%1' is not a link.", key_path.terminal->name));
+
+        return read_range(results, start, count, "Get from RealmResults", [&](size_t i, size_t ndx) {
+            const Obj obj = key_path.follow(results.get(ndx));
+            keys[i] = obj ? obj.get<ObjKey>(key_path.terminal->column_key) : null_key;
+        });
+    });
+}
+
+// Same as results_get_key_path_keys, but reads a primitive terminal property into values.
+REALM_EXPORT size_t results_get_key_path_primitives(Results& results, const size_t* property_chain, size_t chain_length, size_t start, size_t count, PrimitiveValue* values, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        const KeyPath key_path(results.get_realm(), results.get_object_schema(), property_chain, chain_length);
+        verify_primitive(*key_path.terminal);
+
+        return read_range(results, start, count, "Get from RealmResults", [&](size_t i, size_t ndx) {
+            const Obj obj = key_path.follow(results.get(ndx));
+            if (obj) {
+                get_object_primitive(obj, *key_path.terminal, values[i]);
+            }
+            else {
+                values[i].type = key_path.terminal->type;
+                values[i].has_value = false;
+            }
+        });
+    });
+}
+
+// Writes the number of objects linking to each of up to count objects, starting at start, through the
+// linking objects property at property_ndx. Returns the number of counts written.
+REALM_EXPORT size_t results_get_backlink_counts(Results& results, size_t property_ndx, size_t start, size_t count, size_t* counts, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        const BacklinkOrigin origin(results.get_realm(), results.get_object_schema(), property_ndx);
+
+        return read_range(results, start, count, "Get from RealmResults", [&](size_t i, size_t ndx) {
+            counts[i] = results.get(ndx).get_backlink_count(*origin.table, origin.column_key);
+        });
+    });
+}
+
+// See collection_aggregate - property_ndx is ignored for results of primitives.
+REALM_EXPORT void results_aggregate(Results& results, size_t property_ndx, AggregateType type, PrimitiveValue& value, NativeException::Marshallable& ex)
+{
+    collection_aggregate(results, property_ndx, type, value, ex);
+}
+
+// Computes the count, sum, min, max and average of the int, float, double or date property at property_ndx
+// on up to thread_count threads at once - 0 meaning one per core. Only frozen results can be read from
+// several threads, so others are rejected.
+REALM_EXPORT void results_parallel_aggregate(Results& results, size_t property_ndx, size_t thread_count, AggregateSummary& summary, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        if (!results.is_frozen())
+            throw std::logic_error("Parallel aggregates can only be computed on frozen results.");
+
+        if (thread_count == 0)
+            thread_count = std::max(1u, std::thread::hardware_concurrency());
+
+        const Property& property = results.get_object_schema().persisted_properties.at(property_ndx);
+        const auto aggregate = PrimitiveDispatch<ParallelAggregate, DispatchTypes::Numerics>::find(property.type);
+        if (!aggregate)
+            throw std::invalid_argument(util::format("Property '%1' can't be aggregated.", property.name));
+
+        aggregate(results, property, thread_count, summary);
+    });
+}
+
 REALM_EXPORT void results_clear(Results& results, SharedRealm& realm, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
@@ -126,7 +598,7 @@ REALM_EXPORT ManagedNotificationTokenContext* results_add_notification_callback(
 REALM_EXPORT Query* results_get_query(Results& results, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Query(results.get_query());
+        return make_handle<Query>(results.get_query());
     });
 }
 
@@ -140,21 +612,21 @@ REALM_EXPORT DescriptorOrdering* results_get_descriptor_ordering(Results& result
 REALM_EXPORT Results* results_get_filtered_results(const Results& results, uint16_t* query_buf, size_t query_len, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        Utf16StringAccessor query_string(query_buf, query_len);
-        auto query = results.get_query();
-        auto const &realm = results.get_realm();
-
-        parser::ParserResult result = parser::parse(query_string.to_string());
-
-        parser::KeyPathMapping mapping;
-        realm::populate_keypath_mapping(mapping, *realm);
-
         query_builder::NoArguments no_args;
-        query_builder::apply_predicate(query, result.predicate, no_args, mapping);
+        return get_filtered_results(results, query_buf, query_len, no_args);
+    });
+}
 
-        DescriptorOrdering ordering;
-        query_builder::apply_ordering(ordering, query.get_table(), result.ordering);
-        return new Results(realm, std::move(query), std::move(ordering));
+// Same as results_get_filtered_results, with $0, $1, ... in the query bound to arguments. Strings and
+// binaries are read from arena, dates are ticks and objects are given by their key. Since the query
+// text doesn't change with the arguments, it is only parsed once however many times it is applied.
+REALM_EXPORT Results* results_get_filtered_results_with_arguments(const Results& results, uint16_t* query_buf, size_t query_len,
+                                                                  const PropertyValue* arguments, size_t arguments_count, const char* arena,
+                                                                  NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        PropertyValueArguments bound_args(arguments, arguments_count, arena);
+        return get_filtered_results(results, query_buf, query_len, bound_args);
     });
 }
 
@@ -168,14 +640,14 @@ REALM_EXPORT bool results_get_is_valid(const Results& results, NativeException::
 REALM_EXPORT ThreadSafeReference* results_get_thread_safe_reference(const Results& results, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new ThreadSafeReference(results);
+        return make_handle<ThreadSafeReference>(results);
     });
 }
 
 REALM_EXPORT Results* results_snapshot(const Results& results, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Results(results.snapshot());
+        return make_handle<Results>(results.snapshot());
     });
 }
 
@@ -199,7 +671,7 @@ REALM_EXPORT bool results_get_is_frozen(Results& results, NativeException::Marsh
 REALM_EXPORT Results* results_freeze(Results& results, const SharedRealm& realm, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Results(results.freeze(realm));
+        return make_handle<Results>(results.freeze(realm));
     });
 }
 
@@ -21,6 +21,8 @@
 #include "error_handling.hpp"
 #include "realm_export_decls.hpp"
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
+#include "keypath_helpers.hpp"
 
 #include <object_store.hpp>
 #include <binding_context.hpp>
@@ -28,6 +30,7 @@
 #include <object_accessor.hpp>
 #include <thread_safe_reference.hpp>
 
+#include <algorithm>
 #include <list>
 #include <unordered_set>
 #include <sstream>
@@ -48,6 +51,114 @@ namespace binding {
     {
         notify_realm_changed(m_managed_state_handle);
     }
+
+    void CSharpBindingContext::schema_did_change(Schema const& schema)
+    {
+        ++m_schema_change_count;
+    }
+
+    bool CSharpBindingContext::SchemaStamp::update(const Realm& realm, uint64_t schema_change_count)
+    {
+        if (valid && version == realm.schema_version() && change_count == schema_change_count)
+            return false;
+
+        version = realm.schema_version();
+        change_count = schema_change_count;
+        valid = true;
+        return true;
+    }
+
+    const ObjectSchema* CSharpBindingContext::find_object_schema(const Realm& realm, TableKey table_key)
+    {
+        if (m_schema_cache_stamp.update(realm, m_schema_change_count)) {
+            m_schema_cache.clear();
+            for (auto& object_schema : realm.schema()) {
+                m_schema_cache.emplace_back(object_schema.table_key, &object_schema);
+            }
+
+            std::sort(m_schema_cache.begin(), m_schema_cache.end(), [](auto& lhs, auto& rhs) {
+                return lhs.first < rhs.first;
+            });
+        }
+
+        auto it = std::lower_bound(m_schema_cache.begin(), m_schema_cache.end(), table_key, [](auto& entry, TableKey key) {
+            return entry.first < key;
+        });
+
+        return it != m_schema_cache.end() && it->first == table_key ? it->second : nullptr;
+    }
+
+    std::shared_ptr<const parser::ParserResult> CSharpBindingContext::parse_query(const std::string& query)
+    {
+        auto it = m_query_cache_index.find(query);
+        if (it != m_query_cache_index.end()) {
+            m_query_cache.splice(m_query_cache.begin(), m_query_cache, it->second);
+            return it->second->second;
+        }
+
+        auto result = std::make_shared<const parser::ParserResult>(parser::parse(query));
+
+        m_query_cache.emplace_front(query, result);
+        m_query_cache_index.emplace(query, m_query_cache.begin());
+        if (m_query_cache.size() > max_cached_queries) {
+            m_query_cache_index.erase(m_query_cache.back().first);
+            m_query_cache.pop_back();
+        }
+
+        return result;
+    }
+
+    std::shared_ptr<parser::KeyPathMapping> CSharpBindingContext::get_keypath_mapping(Realm& realm)
+    {
+        const Group* group = &realm.read_group();
+        bool schema_changed = m_keypath_mapping_stamp.update(realm, m_schema_change_count);
+        if (schema_changed || !m_keypath_mapping || m_keypath_mapping_group != group) {
+            auto mapping = std::make_shared<parser::KeyPathMapping>();
+            realm::populate_keypath_mapping(*mapping, realm);
+            m_keypath_mapping = std::move(mapping);
+            m_keypath_mapping_group = group;
+        }
+
+        return m_keypath_mapping;
+    }
+
+    const ObjectSchema& get_object_schema_for_table(const SharedRealm& realm, TableKey table_key)
+    {
+        const ObjectSchema* object_schema = nullptr;
+        if (auto context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get())) {
+            object_schema = context->find_object_schema(*realm, table_key);
+        }
+        else {
+            auto& schema = realm->schema();
+            auto it = std::find_if(schema.begin(), schema.end(), [&](auto& candidate) {
+                return candidate.table_key == table_key;
+            });
+            object_schema = it != schema.end() ? &*it : nullptr;
+        }
+
+        if (!object_schema)
+            throw std::logic_error("Table is not part of the Realm's schema.");
+
+        return *object_schema;
+    }
+
+    std::shared_ptr<const parser::ParserResult> parse_query(const SharedRealm& realm, const std::string& query)
+    {
+        if (auto context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get()))
+            return context->parse_query(query);
+
+        return std::make_shared<const parser::ParserResult>(parser::parse(query));
+    }
+
+    std::shared_ptr<parser::KeyPathMapping> get_keypath_mapping(const SharedRealm& realm)
+    {
+        if (auto context = static_cast<CSharpBindingContext*>(realm->m_binding_context.get()))
+            return context->get_keypath_mapping(*realm);
+
+        auto mapping = std::make_shared<parser::KeyPathMapping>();
+        realm::populate_keypath_mapping(*mapping, *realm);
+        return mapping;
+    }
 }
 
 // the name of this class is an ugly hack to get around get_shared_group being private
@@ -235,21 +346,21 @@ REALM_EXPORT bool shared_realm_compact(SharedRealm& realm, NativeException::Mars
 REALM_EXPORT Object* shared_realm_resolve_object_reference(SharedRealm& realm, ThreadSafeReference& reference, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Object(reference.resolve<Object>(realm));
+        return make_handle<Object>(reference.resolve<Object>(realm));
     });
 }
 
 REALM_EXPORT List* shared_realm_resolve_list_reference(SharedRealm& realm, ThreadSafeReference& reference, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new List(reference.resolve<List>(realm));
+        return make_handle<List>(reference.resolve<List>(realm));
     });
 }
 
 REALM_EXPORT Results* shared_realm_resolve_query_reference(SharedRealm& realm, ThreadSafeReference& reference, NativeException::Marshallable& ex)
 {
     return handle_errors(ex, [&]() {
-        return new Results(reference.resolve<Results>(realm));
+        return make_handle<Results>(reference.resolve<Results>(realm));
     });
 }
     
@@ -262,7 +373,7 @@ REALM_EXPORT SharedRealm* shared_realm_resolve_realm_reference(ThreadSafeReferen
     
 REALM_EXPORT void thread_safe_reference_destroy(ThreadSafeReference* reference)
 {
-    delete reference;
+    destroy_handle(reference);
 }
     
 REALM_EXPORT void shared_realm_write_copy(SharedRealm* realm, uint16_t* path, size_t path_len, char* encryption_key, NativeException::Marshallable& ex)
@@ -280,8 +391,7 @@ REALM_EXPORT void shared_realm_write_copy(SharedRealm* realm, uint16_t* path, si
 inline const ObjectSchema& find_schema(const SharedRealm& realm, ConstTableRef& table)
 {
     realm->read_group();
-    const StringData object_name(ObjectStore::object_type_for_table_name(table->get_name()));
-    return *realm->schema().find(object_name);
+    return get_object_schema_for_table(realm, table->get_key());
 }
 
 namespace realm
@@ -312,7 +422,7 @@ Object* create_object_unique(const SharedRealm& realm, TableRef& table, const Ke
         is_new = false;
     }
 
-    auto result = new Object(realm, object_schema, obj);
+    auto result = make_handle<Object>(realm, object_schema, obj);
     
     if (realm->is_partial() && object_schema.name == "__User") {
         result->ensure_user_in_everyone_role();
@@ -329,7 +439,7 @@ REALM_EXPORT Object* shared_realm_create_object(SharedRealm& realm, TableRef& ta
     return handle_errors(ex, [&]() {
         realm->verify_in_write();
  
-        return new Object(realm, table->create_object());
+        return make_handle<Object>(realm, table->create_object());
     });
 }
 
@@ -356,6 +466,13 @@ REALM_EXPORT Object* shared_realm_create_object_string_unique(const SharedRealm&
     });
 }
 
+REALM_EXPORT Object* shared_realm_create_object_string_unique_utf8(const SharedRealm& realm, TableRef& table, const char* key_buf, size_t key_len, bool try_update, bool& is_new, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return create_object_unique(realm, table, utf8_string_data(key_buf, key_len), try_update, is_new);
+    });
+}
+
 REALM_EXPORT void shared_realm_get_schema(const SharedRealm& realm, void* managed_callback, NativeException::Marshallable& ex)
 {
     handle_errors(ex, [&]() {
@@ -23,6 +23,16 @@
 #include "schema_cs.hpp"
 #include "object-store/src/binding_context.hpp"
 #include "object_accessor.hpp"
+#include "object_store.hpp"
+
+#include <realm/parser/keypath_mapping.hpp>
+#include <realm/parser/parser.hpp>
+
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 class ManagedExceptionDuringMigration : public std::runtime_error
 {
@@ -61,14 +71,66 @@ namespace binding {
     public:
         CSharpBindingContext(void* managed_state_handle);
         void did_change(std::vector<CSharpBindingContext::ObserverState> const& observed, std::vector<void*> const& invalidated, bool version_changed) override;
+        void schema_did_change(Schema const& schema) override;
         
         void* get_managed_state_handle()
         {
             return m_managed_state_handle;
         }
+
+        // Looks up the schema of a table by its key rather than by name. The lookup table is rebuilt
+        // whenever the Realm's schema changes. Not locked - frozen Realms, the only ones usable from
+        // several threads, don't get a binding context.
+        const ObjectSchema* find_object_schema(const Realm& realm, TableKey table_key);
+
+        // Parses a query string, keeping the most recently used ones around so that filters which
+        // are applied over and over are only parsed once. Not locked either.
+        std::shared_ptr<const parser::ParserResult> parse_query(const std::string& query);
+
+        // The key path mapping for queries on this Realm. It refers to the tables of the Realm's read
+        // transaction, which stay the same across writes and refreshes, so it is only rebuilt when the
+        // schema changes or the Realm starts over with another transaction. It is handed out mutable
+        // because the query builder takes it by non-const reference, and not locked either.
+        std::shared_ptr<parser::KeyPathMapping> get_keypath_mapping(Realm& realm);
     private:
+        // Identifies the schema a cache was built for.
+        struct SchemaStamp {
+            uint64_t version = ObjectStore::NotVersioned;
+            uint64_t change_count = 0;
+            bool valid = false;
+
+            // Returns true, and takes the new stamp, if the Realm's schema isn't the one the stamp was taken of.
+            bool update(const Realm& realm, uint64_t schema_change_count);
+        };
+
+        using ParsedQuery = std::pair<std::string, std::shared_ptr<const parser::ParserResult>>;
+        static constexpr size_t max_cached_queries = 64;
+
         void* m_managed_state_handle;
+
+        // Bumped on every schema change, so that a schema replaced by another with the same version
+        // still invalidates the caches built for it.
+        uint64_t m_schema_change_count = 0;
+
+        SchemaStamp m_schema_cache_stamp;
+        std::vector<std::pair<TableKey, const ObjectSchema*>> m_schema_cache;
+
+        // Most recently used first.
+        std::list<ParsedQuery> m_query_cache;
+        std::unordered_map<std::string, std::list<ParsedQuery>::iterator> m_query_cache_index;
+
+        SchemaStamp m_keypath_mapping_stamp;
+        const Group* m_keypath_mapping_group = nullptr;
+        std::shared_ptr<parser::KeyPathMapping> m_keypath_mapping;
     };
+
+    // Returns the schema of the table with the given key, going through the cache of the Realm's
+    // binding context when it has one.
+    const ObjectSchema& get_object_schema_for_table(const SharedRealm& realm, TableKey table_key);
+
+    // Parse and key path mapping lookups for query strings, cached by the Realm's binding context when it has one.
+    std::shared_ptr<const parser::ParserResult> parse_query(const SharedRealm& realm, const std::string& query);
+    std::shared_ptr<parser::KeyPathMapping> get_keypath_mapping(const SharedRealm& realm);
 }
     
 }
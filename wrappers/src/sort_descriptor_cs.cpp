@@ -22,6 +22,7 @@
 #include "realm_export_decls.hpp"
 #include "object-store/src/shared_realm.hpp"
 #include "object-store/src/schema.hpp"
+#include "shared_realm_cs.hpp"
 
 
 using namespace realm;
@@ -40,15 +41,16 @@ REALM_EXPORT void sort_descriptor_add_clause(DescriptorOrdering& descriptor, Tab
         std::vector<ColKey> column_keys;
         column_keys.reserve(properties_count);
 
-        const std::string object_name(ObjectStore::object_type_for_table_name(table->get_name()));
-        const std::vector<Property>* properties = &realm->schema().find(object_name)->persisted_properties;
+        ConstTableRef current_table = table;
+        const std::vector<Property>* properties = &get_object_schema_for_table(realm, table->get_key()).persisted_properties;
 
         for (auto i = 0; i < properties_count; ++i) {
             const Property& property = properties->at(property_chain[i]);
             column_keys.push_back(property.column_key);
 
             if (property.type == PropertyType::Object) {
-                properties = &realm->schema().find(property.object_type)->persisted_properties;
+                current_table = current_table->get_link_target(property.column_key);
+                properties = &get_object_schema_for_table(realm, current_table->get_key()).persisted_properties;
             }
         }
 
@@ -0,0 +1,332 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+#include "string_transcoding.hpp"
+
+// SSE2 is part of the x86-64 baseline and NEON of the AArch64 one, so neither
+// needs runtime detection. Everything else uses the scalar loops below.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define REALM_WRAPPERS_SSE2 1
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define REALM_WRAPPERS_NEON 1
+#include <arm_neon.h>
+#endif
+
+using namespace realm::binding;
+
+namespace {
+
+// Narrows the leading ASCII run of [in, in + count) into out, 16 code units at a time.
+// Returns the number of code units consumed - the caller is responsible for the tail.
+inline size_t narrow_ascii(const uint16_t* in, size_t count, char* out) noexcept
+{
+    size_t i = 0;
+#if defined(REALM_WRAPPERS_SSE2)
+    const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+        const __m128i high_bits = _mm_and_si128(_mm_or_si128(a, b), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero)) != 0xFFFF)
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packus_epi16(a, b));
+    }
+#elif defined(REALM_WRAPPERS_NEON)
+    for (; i + 16 <= count; i += 16) {
+        const uint16x8_t a = vld1q_u16(in + i);
+        const uint16x8_t b = vld1q_u16(in + i + 8);
+        if (vmaxvq_u16(vorrq_u16(a, b)) > 0x7F)
+            break;
+
+        vst1q_u8(reinterpret_cast<uint8_t*>(out + i), vcombine_u8(vmovn_u16(a), vmovn_u16(b)));
+    }
+#endif
+    return i;
+}
+
+// Same as narrow_ascii but only measures the run.
+inline size_t ascii_prefix_length(const uint16_t* in, size_t count) noexcept
+{
+    size_t i = 0;
+#if defined(REALM_WRAPPERS_SSE2)
+    const __m128i non_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 8));
+        const __m128i high_bits = _mm_and_si128(_mm_or_si128(a, b), non_ascii);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(high_bits, zero)) != 0xFFFF)
+            break;
+    }
+#elif defined(REALM_WRAPPERS_NEON)
+    for (; i + 16 <= count; i += 16) {
+        if (vmaxvq_u16(vorrq_u16(vld1q_u16(in + i), vld1q_u16(in + i + 8))) > 0x7F)
+            break;
+    }
+#endif
+    return i;
+}
+
+// Widens the leading ASCII run of [in, in + count) into out, 16 bytes at a time.
+// Returns the number of bytes consumed - the caller is responsible for the tail.
+inline size_t widen_ascii(const char* in, size_t count, uint16_t* out) noexcept
+{
+    size_t i = 0;
+#if defined(REALM_WRAPPERS_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= count; i += 16) {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        if (_mm_movemask_epi8(bytes) != 0)
+            break;
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_unpacklo_epi8(bytes, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 8), _mm_unpackhi_epi8(bytes, zero));
+    }
+#elif defined(REALM_WRAPPERS_NEON)
+    for (; i + 16 <= count; i += 16) {
+        const uint8x16_t bytes = vld1q_u8(reinterpret_cast<const uint8_t*>(in + i));
+        if (vmaxvq_u8(bytes) > 0x7F)
+            break;
+
+        vst1q_u16(out + i, vmovl_u8(vget_low_u8(bytes)));
+        vst1q_u16(out + i + 8, vmovl_u8(vget_high_u8(bytes)));
+    }
+#endif
+    return i;
+}
+
+inline bool is_continuation(unsigned char byte) noexcept
+{
+    return (byte & 0xC0) == 0x80;
+}
+
+inline bool is_high_surrogate(uint16_t unit) noexcept
+{
+    return unit >= 0xD800 && unit < 0xDC00;
+}
+
+inline bool is_low_surrogate(uint16_t unit) noexcept
+{
+    return unit >= 0xDC00 && unit < 0xE000;
+}
+
+} // anonymous namespace
+
+namespace realm {
+namespace binding {
+
+TranscodeResult utf16_to_utf8(const uint16_t*& in_begin, const uint16_t* in_end, char*& out_begin, char* out_end) noexcept
+{
+    const uint16_t* in = in_begin;
+    char* out = out_begin;
+    TranscodeResult result = TranscodeResult::Ok;
+
+    while (in != in_end) {
+        const size_t narrowed = narrow_ascii(in, std::min<size_t>(in_end - in, out_end - out), out);
+        in += narrowed;
+        out += narrowed;
+        if (in == in_end)
+            break;
+
+        const uint16_t unit = *in;
+        if (unit < 0x80) {
+            if (out == out_end) {
+                result = TranscodeResult::OutputExhausted;
+                break;
+            }
+            *out++ = static_cast<char>(unit);
+            in += 1;
+        }
+        else if (unit < 0x800) {
+            if (out_end - out < 2) {
+                result = TranscodeResult::OutputExhausted;
+                break;
+            }
+            out[0] = static_cast<char>(0xC0 | (unit >> 6));
+            out[1] = static_cast<char>(0x80 | (unit & 0x3F));
+            out += 2;
+            in += 1;
+        }
+        else if (!is_high_surrogate(unit) && !is_low_surrogate(unit)) {
+            if (out_end - out < 3) {
+                result = TranscodeResult::OutputExhausted;
+                break;
+            }
+            out[0] = static_cast<char>(0xE0 | (unit >> 12));
+            out[1] = static_cast<char>(0x80 | ((unit >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (unit & 0x3F));
+            out += 3;
+            in += 1;
+        }
+        else {
+            if (!is_high_surrogate(unit) || in_end - in < 2 || !is_low_surrogate(in[1])) {
+                result = TranscodeResult::InvalidInput;
+                break;
+            }
+            if (out_end - out < 4) {
+                result = TranscodeResult::OutputExhausted;
+                break;
+            }
+            const uint32_t code_point = 0x10000 + ((uint32_t(unit) - 0xD800) << 10) + (uint32_t(in[1]) - 0xDC00);
+            out[0] = static_cast<char>(0xF0 | (code_point >> 18));
+            out[1] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (code_point & 0x3F));
+            out += 4;
+            in += 2;
+        }
+    }
+
+    in_begin = in;
+    out_begin = out;
+    return result;
+}
+
+size_t utf8_size_for_utf16(const uint16_t* begin, const uint16_t* end) noexcept
+{
+    size_t size = 0;
+    while (begin != end) {
+        const size_t ascii = ascii_prefix_length(begin, end - begin);
+        size += ascii;
+        begin += ascii;
+        if (begin == end)
+            break;
+
+        const uint16_t unit = *begin++;
+        if (unit < 0x80) {
+            size += 1;
+        }
+        else if (unit < 0x800) {
+            size += 2;
+        }
+        else if (is_high_surrogate(unit) && begin != end && is_low_surrogate(*begin)) {
+            size += 4;
+            ++begin;
+        }
+        else {
+            size += 3;
+        }
+    }
+    return size;
+}
+
+TranscodeResult utf8_to_utf16(const char*& in_begin, const char* in_end, uint16_t*& out_begin, uint16_t* out_end) noexcept
+{
+    const char* in = in_begin;
+    uint16_t* out = out_begin;
+    TranscodeResult result = TranscodeResult::Ok;
+
+    while (in != in_end) {
+        const size_t widened = widen_ascii(in, std::min<size_t>(in_end - in, out_end - out), out);
+        in += widened;
+        out += widened;
+        if (in == in_end)
+            break;
+
+        if (out == out_end) {
+            result = TranscodeResult::OutputExhausted;
+            break;
+        }
+
+        const unsigned char lead = static_cast<unsigned char>(*in);
+        const size_t available = in_end - in;
+        if (lead < 0x80) {
+            *out++ = lead;
+            in += 1;
+        }
+        else if (lead < 0xC0) {
+            result = TranscodeResult::InvalidInput;
+            break;
+        }
+        else if (lead < 0xC2) {
+            // C0 and C1 can only start overlong encodings of ASCII
+            result = TranscodeResult::InvalidInput;
+            break;
+        }
+        else if (lead < 0xE0) {
+            if (available < 2 || !is_continuation(in[1])) {
+                result = TranscodeResult::InvalidInput;
+                break;
+            }
+            *out++ = static_cast<uint16_t>(((lead & 0x1F) << 6) | (in[1] & 0x3F));
+            in += 2;
+        }
+        else if (lead < 0xF0) {
+            if (available < 3 || !is_continuation(in[1]) || !is_continuation(in[2])) {
+                result = TranscodeResult::InvalidInput;
+                break;
+            }
+            const uint16_t code_point = static_cast<uint16_t>(((lead & 0x0F) << 12) | ((in[1] & 0x3F) << 6) | (in[2] & 0x3F));
+            if (code_point < 0x800 || is_high_surrogate(code_point) || is_low_surrogate(code_point)) {
+                result = TranscodeResult::InvalidInput;
+                break;
+            }
+            *out++ = code_point;
+            in += 3;
+        }
+        else if (lead < 0xF8) {
+            if (available < 4 || !is_continuation(in[1]) || !is_continuation(in[2]) || !is_continuation(in[3])) {
+                result = TranscodeResult::InvalidInput;
+                break;
+            }
+            const uint32_t code_point = (uint32_t(lead & 0x07) << 18) | (uint32_t(in[1] & 0x3F) << 12) |
+                                        (uint32_t(in[2] & 0x3F) << 6) | uint32_t(in[3] & 0x3F);
+            if (code_point < 0x10000 || code_point > 0x10FFFF) {
+                result = TranscodeResult::InvalidInput;
+                break;
+            }
+            if (out_end - out < 2) {
+                result = TranscodeResult::OutputExhausted;
+                break;
+            }
+            out[0] = static_cast<uint16_t>(0xD800 + ((code_point - 0x10000) >> 10));
+            out[1] = static_cast<uint16_t>(0xDC00 + ((code_point - 0x10000) & 0x3FF));
+            out += 2;
+            in += 4;
+        }
+        else {
+            result = TranscodeResult::InvalidInput;
+            break;
+        }
+    }
+
+    in_begin = in;
+    out_begin = out;
+    return result;
+}
+
+size_t utf16_size_for_utf8(const char* begin, const char* end) noexcept
+{
+    // Every byte that isn't a continuation byte starts a code point, and only
+    // 4 byte sequences need a surrogate pair.
+    size_t size = 0;
+    for (; begin != end; ++begin) {
+        const unsigned char byte = static_cast<unsigned char>(*begin);
+        if (!is_continuation(byte))
+            size += byte >= 0xF0 ? 2 : 1;
+    }
+    return size;
+}
+
+} // namespace binding
+} // namespace realm
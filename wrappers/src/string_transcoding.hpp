@@ -0,0 +1,55 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace realm {
+namespace binding {
+
+enum class TranscodeResult {
+    Ok,
+    // The input is not well formed. The output buffer contents are unspecified.
+    InvalidInput,
+    // The output buffer filled up. in/out point at where conversion should resume.
+    OutputExhausted,
+};
+
+// Converts UTF-16 to UTF-8 in a single pass. Runs of ASCII are narrowed with
+// SSE2/NEON where available and validation happens as the data is converted.
+// On return in_begin and out_begin point past the consumed input and produced output.
+TranscodeResult utf16_to_utf8(const uint16_t*& in_begin, const uint16_t* in_end, char*& out_begin, char* out_end) noexcept;
+
+// Returns the exact number of UTF-8 bytes needed to represent [begin, end).
+// Unpaired surrogates are counted as if they were valid so that the result is
+// always an upper bound for utf16_to_utf8.
+size_t utf8_size_for_utf16(const uint16_t* begin, const uint16_t* end) noexcept;
+
+// Converts UTF-8 to UTF-16 in a single pass, widening runs of ASCII with
+// SSE2/NEON where available. Same in/out contract as utf16_to_utf8. Overlong
+// forms, encoded surrogates and code points past U+10FFFF are invalid input.
+TranscodeResult utf8_to_utf16(const char*& in_begin, const char* in_end, uint16_t*& out_begin, uint16_t* out_end) noexcept;
+
+// Returns the number of UTF-16 code units needed to represent [begin, end),
+// assuming the input is well formed.
+size_t utf16_size_for_utf8(const char* begin, const char* end) noexcept;
+
+} // namespace binding
+} // namespace realm
@@ -24,6 +24,7 @@
 #include "realm_export_decls.hpp"
 #include "sync/partial_sync.hpp"
 #include "schema_cs.hpp"
+#include "shared_realm_cs.hpp"
 #include <realm/parser/parser.hpp>
 #include <realm/parser/query_builder.hpp>
 #include "keypath_helpers.hpp"
@@ -53,10 +54,9 @@ REALM_EXPORT Subscription* realm_subscription_create(Results& results, uint16_t*
             paths.emplace_back(inclusions[i].value);
         }
 
-        parser::KeyPathMapping mapping;
-        realm::populate_keypath_mapping(mapping, *results.get_realm());
+        auto mapping = get_keypath_mapping(results.get_realm());
 
-        auto inclusion_paths = realm::generate_include_from_keypaths(paths, *results.get_realm(), results.get_object_schema(), mapping);
+        auto inclusion_paths = realm::generate_include_from_keypaths(paths, *results.get_realm(), results.get_object_schema(), *mapping);
         
         realm::partial_sync::SubscriptionOptions options;
         options.user_provided_name = name;
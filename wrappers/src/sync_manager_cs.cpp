@@ -22,6 +22,7 @@
 #include "sync_manager_cs.hpp"
 #include "error_handling.hpp"
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
 #include "realm_export_decls.hpp"
 #include "shared_realm_cs.hpp"
 #include "shared_realm.hpp"
@@ -213,7 +214,7 @@ REALM_EXPORT SharedAsyncOpenTask* shared_realm_open_with_sync_async(Configuratio
                     s_open_realm_callback(task_completion_source, nullptr, ec.value(), ec.message().c_str(), ec.message().length());
                 }
             } else {
-                s_open_realm_callback(task_completion_source, new ThreadSafeReference(std::move(ref)), 0, nullptr, 0);
+                s_open_realm_callback(task_completion_source, make_handle<ThreadSafeReference>(std::move(ref)), 0, nullptr, 0);
             }
         });
         
@@ -19,6 +19,7 @@
 #include <realm.hpp>
 #include "error_handling.hpp"
 #include "marshalling.hpp"
+#include "handle_pool.hpp"
 #include "realm_export_decls.hpp"
 
 #include <memory>
@@ -26,6 +27,7 @@
 #include "object-store/src/results.hpp"
 #include "object_accessor.hpp"
 #include "schema.hpp"
+#include "shared_realm_cs.hpp"
 
 using namespace realm;
 using namespace realm::binding;
@@ -36,8 +38,7 @@ Object* get_object_for_primarykey(TableRef& table, SharedRealm& realm, const T&
     return handle_errors(ex, [&]() -> Object* {
         realm->verify_thread();
 
-        const std::string object_name(ObjectStore::object_type_for_table_name(table->get_name()));
-        auto& object_schema = *realm->schema().find(object_name);
+        auto& object_schema = get_object_schema_for_table(realm, table->get_key());
         if (object_schema.primary_key.empty()) {
             const std::string name(table->get_name());
             throw MissingPrimaryKeyException(name);
@@ -48,10 +49,25 @@ Object* get_object_for_primarykey(TableRef& table, SharedRealm& realm, const T&
         if (!obj_key)
             return nullptr;
 
-        return new Object(realm, object_schema, table->get_object(obj_key));
+        return make_handle<Object>(realm, object_schema, table->get_object(obj_key));
         });
 }
 
+template<typename F>
+inline auto with_object_property(TableRef& table, SharedRealm& realm, ObjKey object_key, size_t property_ndx, F&& func)
+{
+    if (realm->is_closed())
+        throw RealmClosedException();
+
+    realm->verify_thread();
+
+    if (!table->is_valid(object_key))
+        throw RowDetachedException();
+
+    const Property& property = get_object_schema_for_table(realm, table->get_key()).persisted_properties[property_ndx];
+    return func(table->get_object(object_key), property);
+}
+
 extern "C" {
 
 REALM_EXPORT void table_destroy(TableRef* table, NativeException::Marshallable& ex)
@@ -67,9 +83,8 @@ REALM_EXPORT Object* table_add_empty_object(TableRef& table, SharedRealm& realm,
         realm->verify_in_write();
 
         Obj obj = table->create_object();
-        const std::string object_name(ObjectStore::object_type_for_table_name(table->get_name()));
-        auto& object_schema = *realm->schema().find(object_name);
-        return new Object(realm, object_schema, obj);
+        auto& object_schema = get_object_schema_for_table(realm, table->get_key());
+        return make_handle<Object>(realm, object_schema, obj);
     });
 }
 
@@ -78,7 +93,7 @@ REALM_EXPORT Results* table_create_results(TableRef& table, SharedRealm& realm,
     return handle_errors(ex, [&]() {
         realm->verify_thread();
 
-        return new Results(realm, table);
+        return make_handle<Results>(realm, table);
     });
 }
 
@@ -106,7 +121,7 @@ REALM_EXPORT Object* table_get_object(TableRef& table, SharedRealm& realm, ObjKe
             return nullptr;
         }
 
-        return new Object(realm, obj);
+        return make_handle<Object>(realm, obj);
     });
 }
 
@@ -126,4 +141,44 @@ REALM_EXPORT Object* table_get_object_for_string_primarykey(TableRef& table, Sha
     return get_object_for_primarykey(table, realm, StringData(str), ex);
 }
 
+REALM_EXPORT Object* table_get_object_for_string_primarykey_utf8(TableRef& table, SharedRealm& realm, const char* value, size_t value_len, NativeException::Marshallable& ex)
+{
+    return get_object_for_primarykey(table, realm, utf8_string_data(value, value_len), ex);
+}
+
+// The table_get_* accessors below read a property of the object with the given key directly, rather
+// than through an Object, so they are a cheaper alternative for reading objects in bulk.
+REALM_EXPORT void table_get_primitive(TableRef& table, SharedRealm& realm, ObjKey object_key, size_t property_ndx, PrimitiveValue& value, NativeException::Marshallable& ex)
+{
+    handle_errors(ex, [&]() {
+        with_object_property(table, realm, object_key, property_ndx, [&](const Obj& obj, const Property& property) {
+            get_object_primitive(obj, property, value);
+        });
+    });
+}
+
+REALM_EXPORT size_t table_get_string(TableRef& table, SharedRealm& realm, ObjKey object_key, size_t property_ndx, uint16_t* string_buffer, size_t buffer_size, bool& is_null, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return with_object_property(table, realm, object_key, property_ndx, [&](const Obj& obj, const Property& property) -> size_t {
+            const StringData value = obj.get<StringData>(property.column_key);
+            if ((is_null = value.is_null()))
+                return 0;
+
+            return stringdata_to_csharpstringbuffer(value, string_buffer, buffer_size);
+        });
+    });
+}
+
+// Returns false if the link is null.
+REALM_EXPORT bool table_get_link_key(TableRef& table, SharedRealm& realm, ObjKey object_key, size_t property_ndx, ObjKey& target_key, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return with_object_property(table, realm, object_key, property_ndx, [&](const Obj& obj, const Property& property) {
+            target_key = obj.get<ObjKey>(property.column_key);
+            return bool(target_key);
+        });
+    });
+}
+
 }   // extern "C"
@@ -0,0 +1,252 @@
+////////////////////////////////////////////////////////////////////////////
+//
+// Copyright 2020 Realm Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+////////////////////////////////////////////////////////////////////////////
+
+#include <realm.hpp>
+#include "error_handling.hpp"
+#include "marshalling.hpp"
+#include "realm_export_decls.hpp"
+#include "shared_realm_cs.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+using namespace realm;
+using namespace realm::binding;
+
+// A link property to traverse, given by the table it is defined on and its persisted property index.
+// Backlink edges are traversed from the objects being linked to, to the objects linking to them.
+struct TraversalEdge
+{
+    TableRef* table;
+    size_t property_ndx;
+    bool backlink;
+};
+
+// The objects reached by a traversal, grouped by table in the order they were first reached.
+struct TraversalResult
+{
+    struct TableKeys {
+        TableRef table;
+        std::vector<ObjKey> keys;
+    };
+
+    std::vector<TableKeys> tables;
+};
+
+namespace {
+
+// An edge resolved against the schema. from and to index TraversalResult::tables.
+struct ResolvedEdge {
+    size_t from;
+    size_t to;
+    ColKey column_key;
+    bool backlink;
+    bool list;
+};
+
+class Traversal {
+public:
+    Traversal(bool deduplicate, size_t max_results)
+        : m_deduplicate(deduplicate)
+        , m_max_results(max_results ? max_results : std::numeric_limits<size_t>::max())
+    {
+    }
+
+    size_t get_table_ndx(TableRef table)
+    {
+        auto& tables = m_result->tables;
+        auto it = std::find_if(tables.begin(), tables.end(), [&](auto& entry) {
+            return entry.table->get_key() == table->get_key();
+        });
+        if (it != tables.end())
+            return it - tables.begin();
+
+        tables.push_back({ std::move(table), {} });
+        m_visited.emplace_back();
+        return tables.size() - 1;
+    }
+
+    void add_edge(const SharedRealm& realm, const TraversalEdge& edge)
+    {
+        const TableRef& origin = *edge.table;
+        const Property& property = get_object_schema_for_table(realm, origin->get_key()).persisted_properties.at(edge.property_ndx);
+        if ((property.type & ~PropertyType::Flags) != PropertyType::Object)
+            throw std::invalid_argument(util::format("Property '%1' is not a link.", property.name));
+
+        const size_t origin_ndx = get_table_ndx(origin);
+        const size_t target_ndx = get_table_ndx(origin->get_link_target(property.column_key));
+        m_edges.push_back({
+            edge.backlink ? target_ndx : origin_ndx,
+            edge.backlink ? origin_ndx : target_ndx,
+            property.column_key,
+            edge.backlink,
+            is_array(property.type)
+        });
+    }
+
+    // Returns false once the result limit is reached.
+    bool visit(size_t table_ndx, ObjKey key)
+    {
+        if (m_count == m_max_results)
+            return false;
+
+        if (m_deduplicate && !m_visited[table_ndx].insert(key.value).second)
+            return true;
+
+        m_result->tables[table_ndx].keys.push_back(key);
+        m_next.push_back({ table_ndx, key });
+        ++m_count;
+        return true;
+    }
+
+    void run(size_t max_depth)
+    {
+        for (size_t depth = 0; depth < max_depth && !m_next.empty(); ++depth) {
+            std::vector<Node> current;
+            current.swap(m_next);
+
+            for (auto& node : current) {
+                const Obj obj = m_result->tables[node.table_ndx].table->get_object(node.key);
+                for (auto& edge : m_edges) {
+                    if (edge.from == node.table_ndx && !follow(obj, edge))
+                        return;
+                }
+            }
+        }
+    }
+
+    std::unique_ptr<TraversalResult> release()
+    {
+        return std::move(m_result);
+    }
+
+private:
+    struct Node {
+        size_t table_ndx;
+        ObjKey key;
+    };
+
+    bool follow(const Obj& obj, const ResolvedEdge& edge)
+    {
+        if (edge.backlink) {
+            const Table& origin = *m_result->tables[edge.to].table;
+            const size_t count = obj.get_backlink_count(origin, edge.column_key);
+            for (size_t i = 0; i < count; ++i) {
+                if (!visit(edge.to, obj.get_backlink(origin, edge.column_key, i)))
+                    return false;
+            }
+            return true;
+        }
+
+        if (edge.list) {
+            const LnkLst list = obj.get_linklist(edge.column_key);
+            for (size_t i = 0; i < list.size(); ++i) {
+                if (!visit(edge.to, list.get(i)))
+                    return false;
+            }
+            return true;
+        }
+
+        const ObjKey target = obj.get<ObjKey>(edge.column_key);
+        return !target || visit(edge.to, target);
+    }
+
+    bool m_deduplicate;
+    size_t m_max_results;
+    size_t m_count = 0;
+
+    std::unique_ptr<TraversalResult> m_result = std::make_unique<TraversalResult>();
+    std::vector<std::unordered_set<int64_t>> m_visited;
+    std::vector<ResolvedEdge> m_edges;
+    std::vector<Node> m_next;
+};
+
+}   // anonymous namespace
+
+extern "C" {
+
+// Walks the object graph breadth first from the objects with start_keys in start_table, following
+// edges up to max_depth links away. Returns every object reached, including the start ones. Without
+// deduplicate objects are reported each time they are reached. max_results caps the number of objects
+// reported, 0 meaning no limit.
+REALM_EXPORT TraversalResult* realm_traverse_links(SharedRealm& realm, TableRef& start_table, const ObjKey* start_keys, size_t start_count,
+                                                   const TraversalEdge* edges, size_t edges_count, size_t max_depth, bool deduplicate, size_t max_results,
+                                                   NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        realm->verify_thread();
+
+        Traversal traversal(deduplicate, max_results);
+        const size_t start_ndx = traversal.get_table_ndx(start_table);
+        for (size_t i = 0; i < edges_count; ++i) {
+            traversal.add_edge(realm, edges[i]);
+        }
+
+        for (size_t i = 0; i < start_count; ++i) {
+            if (start_table->is_valid(start_keys[i]) && !traversal.visit(start_ndx, start_keys[i]))
+                break;
+        }
+
+        traversal.run(max_depth);
+        return traversal.release().release();
+    });
+}
+
+REALM_EXPORT void traversal_result_destroy(TraversalResult* result)
+{
+    delete result;
+}
+
+REALM_EXPORT size_t traversal_result_get_table_count(const TraversalResult& result, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return result.tables.size();
+    });
+}
+
+REALM_EXPORT TableRef* traversal_result_get_table(const TraversalResult& result, size_t table_ndx, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return new TableRef(result.tables.at(table_ndx).table);
+    });
+}
+
+REALM_EXPORT size_t traversal_result_get_key_count(const TraversalResult& result, size_t table_ndx, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        return result.tables.at(table_ndx).keys.size();
+    });
+}
+
+// Writes up to count keys of objects reached in the table at table_ndx, starting at start.
+// Returns the number of keys written.
+REALM_EXPORT size_t traversal_result_get_keys(const TraversalResult& result, size_t table_ndx, size_t start, size_t count, ObjKey* keys, NativeException::Marshallable& ex)
+{
+    return handle_errors(ex, [&]() {
+        auto& table_keys = result.tables.at(table_ndx).keys;
+        count = get_range_count(table_keys.size(), start, count, "Get from TraversalResult");
+        std::copy(table_keys.begin() + start, table_keys.begin() + start + count, keys);
+        return count;
+    });
+}
+
+}   // extern "C"
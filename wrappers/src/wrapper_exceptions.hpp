@@ -38,6 +38,21 @@ namespace realm {
         std::runtime_error(make_message(context, bad_index, count)) {}
     };
 
+    class PropertyTypeMismatchException : public std::runtime_error
+    {
+      static std::string make_message(std::string property, std::string actual_type, std::string expected_type)
+      {
+        std::ostringstream ss;
+        ss << "Property '" << property << "' is of type '" << actual_type << "' but '" << expected_type << "' was expected";
+        return ss.str();
+      }
+
+    public:
+      PropertyTypeMismatchException(std::string message) : std::runtime_error(message) {}
+      PropertyTypeMismatchException(std::string property, std::string actual_type, std::string expected_type):
+        std::runtime_error(make_message(property, actual_type, expected_type)) {}
+    };
+
 
 }   // namespace realm
 